@@ -23,14 +23,25 @@
 #include <bitcoin/protocol/config/sodium.hpp>
 #include <bitcoin/protocol/zmq/authenticator.hpp>
 #include <bitcoin/protocol/zmq/certificate.hpp>
+#include <bitcoin/protocol/zmq/completion_queue.hpp>
 #include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/dispatcher.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/executor.hpp>
 #include <bitcoin/protocol/zmq/frame.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
 #include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/message_schema.hpp>
+#include <bitcoin/protocol/zmq/payload.hpp>
 #include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/reactor.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/scheduler.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/task.hpp>
+#include <bitcoin/protocol/zmq/wakeup.hpp>
 #include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/worker_pool.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
 #endif
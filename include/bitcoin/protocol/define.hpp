@@ -39,13 +39,25 @@
 
 #endif
 
-// context       ->
-// sodium        ->
-// identifiers   ->
-// worker        -> socket
-// message       -> socket
-// certificate   -> sodium
-// socket        -> sodium, context, certificate, identifiers
-// authenticator -> sodium, context, socket, worker
-// poller        -> socket, zeromq
-// frame         -> socket, zeromq
+// context        ->
+// sodium         ->
+// identifiers    ->
+// worker         -> context, socket, frame, message, poller, wakeup
+// worker_pool    -> context, socket, message, poller, worker
+// reactor        -> socket, poller, readiness, worker
+// scheduler      -> socket, message, poller, readiness, task
+// task           ->
+// dispatcher     -> context, socket, message, poller, worker, executor,
+//                   completion_queue, wakeup
+// executor       -> network
+// completion_queue ->
+// message        -> socket, frame, payload
+// message_schema -> message
+// certificate    -> sodium
+// socket         -> sodium, context, certificate, identifiers
+// authenticator  -> sodium, context, socket, worker
+// poller         -> socket, zeromq, identifiers, readiness
+// readiness      ->
+// wakeup         -> zeromq
+// payload        -> frame
+// frame          -> socket, zeromq
@@ -23,8 +23,13 @@
 // Defined here to avoid the network dependency.
 // config::authority and config::endpoint are also cloned from network.
 
+#include <charconv>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 #include <bitcoin/system.hpp>
 
 #ifdef HAVE_MSC
@@ -42,6 +47,7 @@
     #include <pthread.h>
     #include <sys/resource.h>
     #include <sys/types.h>
+    #include <sched.h>
     #define THREAD_PRIORITY_HIGHEST             -20
     #define THREAD_PRIORITY_ABOVE_NORMAL        -2
     #define THREAD_PRIORITY_NORMAL               0
@@ -99,7 +105,6 @@ inline int get_priority(thread_priority priority) NOEXCEPT
 // TODO: handle error conditions.
 // TODO: handle potential lack of PRIO_THREAD
 // TODO: use proper non-win32 priority levels.
-// TODO: Linux: pthread_setschedprio()
 // TOOD: macOS: somethign else.
 inline void set_priority(thread_priority priority) NOEXCEPT
 {
@@ -121,11 +126,159 @@ inline void set_priority(thread_priority priority) NOEXCEPT
 #endif
 }
 
+/// Real-time scheduling policy, normal implies no real-time scheduling.
+enum class thread_policy
+{
+    normal,
+    fifo,
+    round_robin
+};
+
+/// A real-time scheduling policy and its priority. The priority range is
+/// defined by the platform policy (1-99 on Linux), and is ignored if normal.
+struct thread_schedule
+{
+    thread_policy policy{ thread_policy::normal };
+    int32_t priority{};
+};
+
+// Privately map the class enum thread policy value to a platform policy.
+// Windows has no thread scheduling policy (-1 is the zeromq default).
+inline int get_policy([[maybe_unused]] thread_policy policy) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    return -1;
+#else
+    switch (policy)
+    {
+        case thread_policy::fifo:
+            return SCHED_FIFO;
+        case thread_policy::round_robin:
+            return SCHED_RR;
+        default:
+        case thread_policy::normal:
+            return SCHED_OTHER;
+    }
+#endif
+}
+
+// Set the real-time scheduling policy of the calling thread, true if normal.
+// False on failure, commonly due to lack of privilege (Linux: CAP_SYS_NICE or
+// RLIMIT_RTPRIO) or a priority outside of the range of the policy.
+// Windows has no thread scheduling policy, both map to time critical, which a
+// subsequent set_priority would overwrite.
+inline bool set_schedule(const thread_schedule& schedule) NOEXCEPT
+{
+    if (schedule.policy == thread_policy::normal)
+        return true;
+
+#if defined(HAVE_MSC)
+    // learn.microsoft.com/en-us/windows/win32/procthread/scheduling-priorities
+    return SetThreadPriority(GetCurrentThread(),
+        THREAD_PRIORITY_TIME_CRITICAL) != FALSE;
+
+#else
+    // man7.org/linux/man-pages/man3/pthread_setschedparam.3.html
+    const auto policy = get_policy(schedule.policy);
+
+    if (schedule.priority < sched_get_priority_min(policy) ||
+        schedule.priority > sched_get_priority_max(policy))
+        return false;
+
+    sched_param parameter{};
+    parameter.sched_priority = schedule.priority;
+    return system::is_zero(pthread_setschedparam(pthread_self(), policy,
+        &parameter));
+#endif
+}
+
 inline size_t cores() NOEXCEPT
 {
     return std::max(std::thread::hardware_concurrency(), 1_u32);
 }
 
+/// Logical processor indexes, an empty set implies no affinity.
+typedef std::vector<size_t> processors;
+
+// Get the logical processors of a NUMA node, empty if unknown.
+// Linux only, read from sysfs (e.g. "0-7,16-23") to avoid a libnuma dependency.
+inline processors numa_processors([[maybe_unused]] size_t node) NOEXCEPT
+{
+    processors out{};
+
+#if defined(__linux__)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::ifstream file{ "/sys/devices/system/node/node" +
+        std::to_string(node) + "/cpulist" };
+
+    std::string range{};
+    while (std::getline(file, range, ','))
+    {
+        size_t first{}, last{};
+        const auto begin = range.data();
+        const auto end = std::next(begin, range.size());
+        const auto [next, ec] = std::from_chars(begin, end, first);
+
+        if (ec != std::errc{})
+            return {};
+
+        // A range is "first-last", a single processor is "first".
+        last = first;
+        if (next != end && *next == '-' &&
+            std::from_chars(std::next(next), end, last).ec != std::errc{})
+            return {};
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+            out.push_back(cpu);
+    }
+    BC_POP_WARNING()
+#endif
+
+    return out;
+}
+
+// Pin the calling thread to the processors, true if empty (no change).
+// False if any processor is out of range or the platform does not support
+// affinity (macOS provides only affinity hints, which are not applied).
+inline bool set_affinity(const processors& cpus) NOEXCEPT
+{
+    if (cpus.empty())
+        return true;
+
+#if defined(HAVE_MSC)
+    // learn.microsoft.com/en-us/windows/win32/api/winbase/
+    // nf-winbase-setthreadaffinitymask
+    DWORD_PTR mask{};
+    for (const auto cpu: cpus)
+    {
+        if (cpu >= sizeof(DWORD_PTR) * 8u)
+            return false;
+
+        mask |= (DWORD_PTR{ 1 } << cpu);
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+
+#elif defined(__linux__)
+    // man7.org/linux/man-pages/man3/pthread_setaffinity_np.3.html
+    cpu_set_t mask{};
+    CPU_ZERO(&mask);
+    for (const auto cpu: cpus)
+    {
+        if (cpu >= CPU_SETSIZE)
+            return false;
+
+        CPU_SET(cpu, &mask);
+    }
+
+    return system::is_zero(pthread_setaffinity_np(pthread_self(), sizeof(mask),
+        &mask));
+
+#else
+    return false;
+#endif
+}
+
 } // namespace protocol
 } // namespace libbitcoin
 
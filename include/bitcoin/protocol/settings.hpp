@@ -22,6 +22,7 @@
 #include <filesystem>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -59,6 +60,41 @@ struct BCP_API settings
 
     // ZMQ_SNDTIMEO (0 unlimited)
     uint32_t send_milliseconds;
+
+    /// ZMQ_AFFINITY (0 any, bit n selects context I/O thread n)
+    /// Applies to connections subsequently bound/connected by the socket.
+    uint64_t io_thread_affinity;
+};
+
+/// Most values are capped at max_int32.
+/// zeromq context configuration settings, properties not thread safe.
+/// These are applied when the context is started, before any socket exists.
+struct BCP_API context_settings
+{
+    DEFAULT_COPY_MOVE_DESTRUCT(context_settings);
+
+    context_settings() NOEXCEPT;
+
+    /// ZMQ_IO_THREADS (one per four cores, minimum one, 0 disabled)
+    uint32_t io_threads;
+
+    /// ZMQ_MAX_SOCKETS (zeromq default 1023)
+    uint32_t maximum_sockets;
+
+    /// ZMQ_MAX_MSGSZ (0 unlimited)
+    uint32_t maximum_message_size;
+
+    /// ZMQ_ZERO_COPY_RECV (large received messages reference the receive
+    /// buffer rather than being copied, at the cost of buffer retention)
+    /// This is a draft option in zeromq 4.3, without which zero copy is
+    /// always on, so false fails context start unless zeromq defines it.
+    bool zero_copy_receive;
+
+    /// ZMQ_THREAD_AFFINITY_CPU_ADD (empty unpinned)
+    processors io_affinity;
+
+    /// ZMQ_THREAD_SCHED_POLICY and ZMQ_THREAD_PRIORITY (normal unscheduled)
+    thread_schedule io_schedule;
 };
 
 } // namespace blockchain
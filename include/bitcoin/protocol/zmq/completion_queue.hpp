@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_COMPLETION_QUEUE_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_COMPLETION_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe (lock free) for any number of producers and one
+/// consumer at a time. Producers push items onto an intrusive list with a
+/// single atomic exchange loop, and the consumer takes the entire list with
+/// one atomic exchange, so neither producers nor the consumer ever block.
+template <typename Type>
+class completion_queue
+{
+public:
+    DELETE_COPY_MOVE(completion_queue);
+
+    /// Construct an empty queue.
+    completion_queue() NOEXCEPT
+      : head_(nullptr)
+    {
+    }
+
+    /// Destroy any undrained items.
+    ~completion_queue() NOEXCEPT
+    {
+        drain([](Type&) NOEXCEPT {});
+    }
+
+    /// Thread safe, push an item onto the queue.
+    /// True if the queue was empty, in which case the consumer should be
+    /// signaled (an empty queue has no pending signal).
+    bool push(Type&& value) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        const auto item = new node{ std::move(value), nullptr };
+        BC_POP_WARNING()
+        BC_POP_WARNING()
+
+        item->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(item->next, item,
+            std::memory_order_release, std::memory_order_relaxed));
+
+        return item->next == nullptr;
+    }
+
+    /// Consumer only, invoke handler(Type&) for each item in push order.
+    /// Items pushed during the drain are left for the next drain.
+    /// Returns the number of items drained.
+    template <typename Handler>
+    size_t drain(Handler&& handler) NOEXCEPT
+    {
+        auto item = head_.exchange(nullptr, std::memory_order_acquire);
+
+        // The list is taken in reverse push order.
+        node* ordered{ nullptr };
+        while (item != nullptr)
+        {
+            const auto next = item->next;
+            item->next = ordered;
+            ordered = item;
+            item = next;
+        }
+
+        size_t count{};
+        while (ordered != nullptr)
+        {
+            const auto next = ordered->next;
+            handler(ordered->value);
+
+            BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+            delete ordered;
+            BC_POP_WARNING()
+
+            ordered = next;
+            ++count;
+        }
+
+        return count;
+    }
+
+    /// True if the queue is empty (a snapshot).
+    bool empty() const NOEXCEPT
+    {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct node
+    {
+        Type value;
+        node* next;
+    };
+
+    std::atomic<node*> head_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -25,6 +25,7 @@
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/settings.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -40,9 +41,15 @@ public:
     /// A shared context pointer.
     typedef std::shared_ptr<context> ptr;
 
-    /// Construct a context.
+    /// Construct a context with default settings, except for one I/O thread
+    /// (the zeromq default).
     context(bool started=true) NOEXCEPT;
 
+    /// Construct a context with the given settings. I/O threads may be
+    /// pinned to processors (such as those of the consuming workers' NUMA
+    /// node) and real-time scheduled (not applied by zeromq on Windows).
+    context(bool started, const context_settings& settings) NOEXCEPT;
+
     /// Blocks until all child sockets are closed.
     /// Stops all child socket activity by closing the zeromq context.
     ~context() NOEXCEPT;
@@ -53,7 +60,8 @@ public:
     /// The underlying zeromq context.
     void* self() NOEXCEPT;
 
-    /// Create the zeromq context.
+    /// Create and configure the zeromq context, false if started or if the
+    /// settings cannot be applied (in which case the context is not started).
     bool start() NOEXCEPT;
 
     /// Blocks until all child sockets are closed.
@@ -61,8 +69,11 @@ public:
     bool stop() NOEXCEPT;
 
 private:
+    bool configure(void* self) const NOEXCEPT;
+
     // This is thread safe
     std::atomic<void*> self_;
+    const context_settings settings_;
 
     // This guards against a start/stop race.
     mutable std::shared_mutex mutex_;
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_DISPATCHER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_DISPATCHER_HPP
+
+#include <memory>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/completion_queue.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/executor.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/wakeup.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Requests received on the front (router) endpoint are handled as tasks of
+/// a work-stealing executor, without a relay or inproc hop per request.
+/// Replies are returned to the socket thread by a lock-free completion queue
+/// and sent from there, as the router socket is not thread safe. The socket
+/// thread is woken by a wakeup signal when the queue becomes non-empty. A
+/// reply is routed by the envelope (identity and any empty delimiter) of its
+/// request, so requester and dealer clients are both supported. Derive to
+/// implement handle().
+class BCP_API dispatcher
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(dispatcher);
+
+    /// A shared dispatcher pointer.
+    typedef std::shared_ptr<dispatcher> ptr;
+
+    /// The maximum number of requests received between sends of replies.
+    static constexpr size_t receive_batch = 16;
+
+    /// Construct a dispatcher with the given number of handler threads (one
+    /// per core by default). The context must outlive the dispatcher. The
+    /// socket and handler threads are pinned to the affinity processors,
+    /// if any, and scheduled alike.
+    dispatcher(context& context, const system::config::endpoint& endpoint,
+        size_t threads=cores(),
+        thread_priority priority=thread_priority::normal,
+        const processors& affinity={},
+        const thread_schedule& schedule={}) NOEXCEPT;
+
+    /// Stop the dispatcher.
+    virtual ~dispatcher() NOEXCEPT;
+
+    /// The number of handler threads.
+    size_t threads() const NOEXCEPT;
+
+protected:
+    /// Called on any handler thread, must be thread safe.
+    /// Handle the request by populating the reply (sent even if empty).
+    /// The request envelope has been removed and the reply is addressed.
+    virtual void handle(message& request, message& reply) NOEXCEPT = 0;
+
+    /// Receive requests, dispatch handlers and send completed replies.
+    void work() NOEXCEPT override;
+
+private:
+    void dispatch(message&& request) NOEXCEPT;
+    void complete(message&& reply) NOEXCEPT;
+    void drain(socket& router) NOEXCEPT;
+
+    context& context_;
+    const system::config::endpoint endpoint_;
+
+    // These are thread safe.
+    executor executor_;
+    completion_queue<message> completions_;
+    wakeup completed_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
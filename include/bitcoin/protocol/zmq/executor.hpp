@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_EXECUTOR_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// A work-stealing task executor. Each thread owns a task queue, which it
+/// runs from the back (most recent first, while its data is cache warm).
+/// An idle thread steals from the front (oldest first) of other queues, so
+/// that a burst of tasks submitted to one queue spreads across all threads.
+/// Tasks submitted from an executor thread are queued to that thread, and
+/// tasks submitted from other threads are distributed round robin.
+class BCP_API executor
+{
+public:
+    DELETE_COPY_MOVE(executor);
+
+    /// A unit of work, must not throw.
+    typedef std::function<void()> task;
+
+    /// Construct an executor of the given number of threads (one per core
+    /// by default), not started. Threads are pinned to the affinity
+    /// processors, if any (each may run on any of them), and scheduled.
+    executor(size_t threads=cores(),
+        thread_priority priority=thread_priority::normal,
+        const processors& affinity={},
+        const thread_schedule& schedule={}) NOEXCEPT;
+
+    /// Stop the executor.
+    virtual ~executor() NOEXCEPT;
+
+    /// Start the threads, false if started or not pinned or scheduled.
+    bool start() NOEXCEPT;
+
+    /// Stop and join the threads, tasks not yet started are discarded.
+    /// A task must not stop its own executor.
+    bool stop() NOEXCEPT;
+
+    /// Queue a task for execution, false if stopped.
+    bool submit(task&& work) NOEXCEPT;
+
+    /// The number of threads.
+    size_t threads() const NOEXCEPT;
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    void run(size_t index, std::latch& configured) NOEXCEPT;
+    void halt() NOEXCEPT;
+    bool pop(size_t index, task& out) NOEXCEPT;
+    bool steal(size_t index, task& out, bool wait) NOEXCEPT;
+    void clear() NOEXCEPT;
+
+    // These are thread safe.
+    const size_t count_;
+    const thread_priority priority_;
+    const processors affinity_;
+    const thread_schedule schedule_;
+    const std::vector<std::unique_ptr<queue>> queues_;
+    std::atomic<bool> stopped_;
+    std::atomic<bool> unconfigured_;
+    std::atomic<size_t> pending_;
+    std::atomic<size_t> next_;
+
+    // Idle threads wait on this.
+    std::mutex idle_mutex_;
+    std::condition_variable idle_;
+
+    // These are protected by mutex.
+    std::vector<std::thread> threads_;
+    mutable std::shared_mutex mutex_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
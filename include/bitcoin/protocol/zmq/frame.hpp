@@ -35,16 +35,33 @@ class BCP_API frame
   : public enable_shared_from_base<frame>
 {
 public:
-    DEFAULT_COPY_MOVE(frame);
-
     /// A shared frame pointer.
     typedef std::shared_ptr<frame> ptr;
 
     /// Construct a frame with no payload (for receiving).
     frame() NOEXCEPT;
 
-    /// Construct a frame with the specified payload (for sending).
-    frame(const system::data_chunk& data) NOEXCEPT;
+    /// Construct a frame with an uninitialized payload (for writing).
+    explicit frame(size_t size) NOEXCEPT;
+
+    /// Construct a frame with a copy of the payload (for sending).
+    frame(const system::data_slice& data) NOEXCEPT;
+
+    /// Construct a frame that adopts the payload without copy (for sending).
+    /// Ownership of the buffer passes to zeromq, which frees it when sent.
+    frame(system::data_chunk&& data) NOEXCEPT;
+
+    /// Construct a frame that shares the payload without copy (for sending).
+    /// zeromq holds a reference to the buffer until sent, do not modify it.
+    frame(const system::chunk_ptr& data) NOEXCEPT;
+
+    /// Move the payload of the other frame (without copy).
+    frame(frame&& other) NOEXCEPT;
+    frame& operator=(frame&& other) NOEXCEPT;
+
+    /// Reference the payload of the other frame (zeromq may copy if small).
+    frame(const frame& other) NOEXCEPT;
+    frame& operator=(const frame& other) NOEXCEPT;
 
     /// Free the frame's allocated memory.
     ~frame() NOEXCEPT;
@@ -55,19 +72,38 @@ public:
     /// True if there is more data to receive.
     bool more() const NOEXCEPT;
 
-    /// The initialized or received payload of the frame.
+    /// The size of the initialized or received payload of the frame.
+    size_t size() const NOEXCEPT;
+
+    /// A view of the initialized or received payload of the frame.
+    /// The view is invalidated by send, receive, assignment or destruction.
+    system::data_slice data() const NOEXCEPT;
+
+    /// A copy of the initialized or received payload of the frame.
     system::data_chunk payload() const NOEXCEPT;
 
+    /// A writable view of the payload of the frame (for writing).
+    /// The view is invalidated by send, receive, assignment or destruction.
+    system::data_slab buffer() NOEXCEPT;
+
     /// Must be called on the socket thread.
-    /// Receive a frame on the socket.
-    error::code receive(socket& socket) NOEXCEPT;
+    /// Receive a frame on the socket, try_again if !wait and none available.
+    error::code receive(socket& socket, bool wait=true) NOEXCEPT;
 
     /// Must be called on the socket thread.
-    /// Send a frame on the socket.
-    error::code send(socket& socket, bool last) NOEXCEPT;
+    /// Send a frame on the socket, try_again if !wait and cannot send now.
+    error::code send(socket& socket, bool last, bool wait=true) NOEXCEPT;
 
 private:
-    bool initialize(const system::data_chunk& data) NOEXCEPT;
+    static void free_chunk(void* data, void* hint) NOEXCEPT;
+    static void free_shared(void* data, void* hint) NOEXCEPT;
+
+    bool initialize(size_t size) NOEXCEPT;
+    bool initialize(const system::data_slice& data) NOEXCEPT;
+    bool initialize(system::data_chunk&& data) NOEXCEPT;
+    bool initialize(const system::chunk_ptr& data) NOEXCEPT;
+    bool move(frame& other) NOEXCEPT;
+    bool copy(const frame& other) NOEXCEPT;
     bool set_more(socket& socket) NOEXCEPT;
     bool destroy() NOEXCEPT;
 
@@ -47,6 +47,9 @@ public:
     // Allow poller to push identifiers.
     void push(const void* socket) NOEXCEPT;
 
+    // Allow poller to push descriptors, which are identified by value.
+    void push(identifier descriptor) NOEXCEPT;
+
 private:
     std::vector<identifier> ids_;
 };
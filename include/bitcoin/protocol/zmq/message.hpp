@@ -19,10 +19,14 @@
 #ifndef LIBBITCOIN_PROTOCOL_ZMQ_MESSAGE_HPP
 #define LIBBITCOIN_PROTOCOL_ZMQ_MESSAGE_HPP
 
-#include <queue>
+#include <memory_resource>
+#include <string>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/payload.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 
 namespace libbitcoin {
@@ -30,10 +34,23 @@ namespace protocol {
 namespace zmq {
 
 /// This class is not thread safe.
+/// Parts are retained as zeromq frames, so received payloads are not copied
+/// until dequeued and sent payloads are not copied once enqueued.
+/// Parts up to zmq_maximum_inline_size are stored inline by zeromq and part
+/// storage is retained across clear/receive, so reuse avoids allocation.
+/// Part storage may be allocated from a polymorphic memory resource, and
+/// parts may be dequeued into containers of the caller's memory resource.
+/// Part payloads are owned by zeromq, which may release them on its own
+/// threads after send, so they are never allocated from the resource.
 class BCP_API message
 {
 public:
-    DEFAULT_COPY_MOVE_DESTRUCT(message);
+    DEFAULT_COPY(message);
+
+    /// The moved-from message is empty.
+    message(message&& other) NOEXCEPT;
+    message& operator=(message&& other) NOEXCEPT;
+    ~message() = default;
 
     /// A zeromq route identifier is always this size.
     static constexpr size_t address_size = 5;
@@ -41,37 +58,130 @@ public:
     /// An identifier for message routing.
     typedef system::data_array<address_size> address;
 
+    /// A data chunk allocated from a polymorphic memory resource.
+    typedef std::pmr::vector<uint8_t> pmr_chunk;
+
+    /// The message parts, from the top of the queue.
+    typedef std::pmr::vector<frame> frames;
+    typedef frames::const_iterator const_iterator;
+
+    /// This class is not thread safe.
+    /// Reads message parts in order without removing them from the message,
+    /// so that a message may be inspected and then forwarded unmodified.
+    /// A read advances past the part whether or not it is valid.
+    /// The cursor is invalidated by any change to the message.
+    class BCP_API cursor
+    {
+    public:
+        DEFAULT_COPY_MOVE_DESTRUCT(cursor);
+
+        /// Construct a cursor at the top of the message queue.
+        cursor(const message& packet) NOEXCEPT;
+
+        /// Read an unsigned part, false if no part or invalid.
+        template <typename Unsigned>
+        bool read(Unsigned& value) NOEXCEPT
+        {
+            if (empty())
+                return false;
+
+            const auto data = next();
+
+            if (data.size() != sizeof(Unsigned))
+                return false;
+
+            value = system::from_little_endian<Unsigned>(data);
+            return true;
+        }
+
+        /// Read a part, false if no part or invalid.
+        bool read(system::data_slice& value) NOEXCEPT;
+        bool read(system::data_chunk& value) NOEXCEPT;
+        bool read(std::string& value) NOEXCEPT;
+        bool read(system::hash_digest& value) NOEXCEPT;
+        bool read(address& value) NOEXCEPT;
+
+        /// View the next part without reading it, empty if no part.
+        system::data_slice peek() const NOEXCEPT;
+
+        /// Advance past the next part, false if no part.
+        bool skip() NOEXCEPT;
+
+        /// True if there are no more parts to read.
+        bool empty() const NOEXCEPT;
+
+        /// The number of parts read (or skipped).
+        size_t position() const NOEXCEPT;
+
+        /// The number of parts remaining to be read.
+        size_t remaining() const NOEXCEPT;
+
+    private:
+        system::data_slice next() NOEXCEPT;
+
+        const message* packet_;
+        size_t position_;
+    };
+
     /// Add an unsigned integer message part to the outgoing message.
     template <typename Unsigned>
     void enqueue_little_endian(Unsigned value) NOEXCEPT
     {
-        queue_.emplace(system::to_chunk(
-            system::to_little_endian<Unsigned>(value)));
+        parts_.emplace_back(system::to_little_endian<Unsigned>(value));
+    }
+
+    /// Add a byte array message part to the outgoing message.
+    template <size_t Size>
+    void enqueue(const system::data_array<Size>& value) NOEXCEPT
+    {
+        parts_.emplace_back(value);
+    }
+
+    /// Serialize an object (such as chain::block) into a new message part.
+    /// The part is sized from serialized_size(args...) and the object is
+    /// written by to_data(writer&, args...) directly into the zeromq buffer.
+    /// False (and no part is added) if the part cannot be allocated/written.
+    template <typename Object, typename... Args>
+    bool enqueue_serialized(const Object& object, Args... args) NOEXCEPT
+    {
+        auto& part = parts_.emplace_back(object.serialized_size(args...));
+        system::write::bytes::copy sink{ part.buffer() };
+        object.to_data(sink, args...);
+
+        if (part && sink)
+            return true;
+
+        parts_.pop_back();
+        return false;
     }
 
     /// Remove an unsigned from the queue top, false if empty queue or invalid.
     template <typename Unsigned>
     bool dequeue(Unsigned& value) NOEXCEPT
     {
-        if (queue_.empty())
+        if (empty())
             return false;
 
-        const auto& front = queue_.front();
+        const auto& front = top();
 
         if (front.size() == sizeof(Unsigned))
         {
-            value = system::from_little_endian<Unsigned>(front);
-            queue_.pop();
+            value = system::from_little_endian<Unsigned>(front.data());
+            pop();
             return true;
         }
 
-        queue_.pop();
+        pop();
         return false;
     }
 
-    /// Construct.
+    /// Construct with part storage from the default memory resource.
     message() NOEXCEPT;
 
+    /// Construct with part storage from the specified memory resource.
+    /// The resource must outlive the message (and is not propagated on copy).
+    explicit message(std::pmr::memory_resource* resource) NOEXCEPT;
+
     /// Add an empty message part to the outgoing message.
     void enqueue() NOEXCEPT;
 
@@ -87,14 +197,33 @@ public:
     /// Move an identifier message part to the outgoing message.
     void enqueue(const address& value) NOEXCEPT;
 
+    /// Add a shared payload message part to the outgoing message (no copy).
+    void enqueue(const payload& value) NOEXCEPT;
+
+    /// View the message part at the top of the queue, empty if empty queue.
+    /// The view is invalidated when the part is removed from the queue.
+    system::data_slice front() const NOEXCEPT;
+
+    /// View the message part at the index from the top of the queue, empty
+    /// if out of range. The view is invalidated when the part is removed.
+    system::data_slice part(size_t index) const NOEXCEPT;
+
+    /// Iterate the message parts from the top of the queue without removal.
+    /// Iterators are invalidated by any change to the message.
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+
     /// Remove a message part from the top of the queue, empty if empty queue.
     system::data_chunk dequeue_data() NOEXCEPT;
     std::string dequeue_text() NOEXCEPT;
 
     /// Remove a part from the queue top, false if empty queue or invalid.
+    /// Containers are assigned in place, retaining capacity and allocator.
     bool dequeue() NOEXCEPT;
     bool dequeue(system::data_chunk& value) NOEXCEPT;
     bool dequeue(std::string& value) NOEXCEPT;
+    bool dequeue(pmr_chunk& value) NOEXCEPT;
+    bool dequeue(std::pmr::string& value) NOEXCEPT;
     bool dequeue(system::hash_digest& value) NOEXCEPT;
     bool dequeue(address& value) NOEXCEPT;
 
@@ -108,15 +237,44 @@ public:
     size_t size() const NOEXCEPT;
 
     /// Must be called on the socket thread.
-    /// Send the message in parts. If a send fails the unsent parts remain.
-    error::code send(socket& socket) NOEXCEPT;
+    /// Send the message in parts. If a send fails the unsent parts remain,
+    /// including the part that failed, and a subsequent send resumes the
+    /// message. If !wait only the first part is sent without waiting, so if
+    /// the message cannot be sent now try_again is returned and the message
+    /// is unchanged. Once the first part is accepted the remaining parts are
+    /// sent waiting, as zeromq may not accept all parts of a message at once
+    /// and cannot retract parts that it has accepted.
+    error::code send(socket& socket, bool wait=true) NOEXCEPT;
 
     /// Must be called on the socket thread.
-    /// Receve a message (clears the queue first).
-    error::code receive(socket& socket) NOEXCEPT;
+    /// Receve a message (clears the queue first). If !wait and no message is
+    /// available, try_again is returned and the queue is empty. zeromq
+    /// delivers multipart messages atomically, so remaining parts of an
+    /// available message are always received.
+    error::code receive(socket& socket, bool wait=true) NOEXCEPT;
 
 protected:
-    std::queue<system::data_chunk> queue_;
+    // Parts before offset have been dequeued (and released).
+    frames parts_;
+    size_t offset_;
+
+private:
+    template <typename Container>
+    bool assign(Container& value) NOEXCEPT
+    {
+        if (empty())
+            return false;
+
+        const auto data = top().data();
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        value.assign(data.begin(), data.end());
+        BC_POP_WARNING()
+        pop();
+        return true;
+    }
+
+    const frame& top() const NOEXCEPT;
+    void pop() NOEXCEPT;
 };
 
 } // namespace zmq
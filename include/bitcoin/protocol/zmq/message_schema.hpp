@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_MESSAGE_SCHEMA_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_MESSAGE_SCHEMA_HPP
+
+#include <array>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe (stateless).
+/// A compile time description of a multipart message, with one part per
+/// type. Supported part types are unsigned integers (little endian), byte
+/// arrays (such as message::address and hash_digest), std::string and
+/// data_chunk. Decoding validates the part count and every fixed part size
+/// before any value is assigned, so an invalid message is rejected before
+/// any allocation. Variable parts are assigned in place (retaining capacity).
+template <typename... Parts>
+class message_schema
+{
+public:
+    /// The decoded representation of the message.
+    typedef std::tuple<Parts...> values;
+
+    /// The size of a variable size part.
+    static constexpr size_t variable = system::max_size_t;
+
+    /// The number of parts in the message.
+    static constexpr size_t parts = sizeof...(Parts);
+
+    /// The size of the part at the index, variable if not fixed.
+    template <size_t Index>
+    static constexpr size_t part_size() NOEXCEPT
+    {
+        return size<std::tuple_element_t<Index, values>>();
+    }
+
+    /// True if all parts are of fixed size.
+    static constexpr bool is_fixed() NOEXCEPT
+    {
+        return ((size<Parts>() != variable) && ...);
+    }
+
+    /// The sum of the sizes of all fixed size parts.
+    static constexpr size_t fixed_size() NOEXCEPT
+    {
+        return ((size<Parts>() == variable ? system::zero : size<Parts>()) +
+            ... + system::zero);
+    }
+
+    /// True if the message conforms to the schema (does not modify message).
+    static bool is_valid(const message& packet) NOEXCEPT
+    {
+        return is_valid(packet, std::index_sequence_for<Parts...>{});
+    }
+
+    /// Decode the message in one pass, false (values unchanged) if invalid.
+    /// The message is not modified.
+    static bool decode(values& out, const message& packet) NOEXCEPT
+    {
+        if (!is_valid(packet))
+            return false;
+
+        decode(out, packet, std::index_sequence_for<Parts...>{});
+        return true;
+    }
+
+    /// Decode and clear the message, false (values unchanged) if invalid.
+    /// The message is cleared whether or not it is valid.
+    static bool dequeue(values& out, message& packet) NOEXCEPT
+    {
+        const auto result = decode(out, packet);
+        packet.clear();
+        return result;
+    }
+
+    /// Encode the values into the message (appended to any existing parts).
+    static void enqueue(message& packet, const values& in) NOEXCEPT
+    {
+        std::apply([&](const auto&... value) NOEXCEPT
+        {
+            (encode(packet, value), ...);
+        }, in);
+    }
+
+private:
+    template <typename Part>
+    struct is_array
+      : std::false_type
+    {
+    };
+
+    template <size_t Size>
+    struct is_array<std::array<uint8_t, Size>>
+      : std::true_type
+    {
+    };
+
+    template <typename Part>
+    static constexpr size_t size() NOEXCEPT
+    {
+        if constexpr (is_array<Part>::value)
+            return std::tuple_size_v<Part>;
+        else if constexpr (std::is_unsigned_v<Part>)
+            return sizeof(Part);
+        else
+        {
+            static_assert(std::is_same_v<Part, std::string> ||
+                std::is_same_v<Part, system::data_chunk>,
+                "unsupported message part type");
+            return variable;
+        }
+    }
+
+    template <typename Part>
+    static bool is_valid_part(const system::data_slice& data) NOEXCEPT
+    {
+        constexpr auto expected = size<Part>();
+        return expected == variable || data.size() == expected;
+    }
+
+    template <size_t... Index>
+    static bool is_valid(const message& packet,
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        return packet.size() == parts &&
+            (is_valid_part<Parts>(packet.part(Index)) && ...);
+    }
+
+    template <typename Part>
+    static void decode_part(Part& out, const system::data_slice& data) NOEXCEPT
+    {
+        if constexpr (is_array<Part>::value)
+            std::copy(data.begin(), data.end(), out.begin());
+        else if constexpr (std::is_unsigned_v<Part>)
+            out = system::from_little_endian<Part>(data);
+        else
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            out.assign(data.begin(), data.end());
+            BC_POP_WARNING()
+        }
+    }
+
+    template <size_t... Index>
+    static void decode(values& out, const message& packet,
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        (decode_part(std::get<Index>(out), packet.part(Index)), ...);
+    }
+
+    template <typename Part>
+    static void encode(message& packet, const Part& value) NOEXCEPT
+    {
+        if constexpr (std::is_unsigned_v<Part>)
+            packet.enqueue_little_endian<Part>(value);
+        else
+            packet.enqueue(value);
+    }
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
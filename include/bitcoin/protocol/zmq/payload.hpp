@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_PAYLOAD_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_PAYLOAD_HPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe (immutable).
+/// A reference counted payload that may be enqueued into any number of
+/// messages and sent on any number of sockets (on any threads) without copy.
+/// Each frame holds a reference to the buffer until zeromq releases it, so
+/// fan-out cost is independent of payload size.
+class BCP_API payload
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(payload);
+
+    /// Construct an empty payload.
+    payload() NOEXCEPT;
+
+    /// Construct a payload with a copy of the data.
+    payload(const system::data_slice& data) NOEXCEPT;
+
+    /// Construct a payload that adopts the data without copy.
+    payload(system::data_chunk&& data) NOEXCEPT;
+
+    /// Construct a payload that shares the data without copy.
+    /// The data must not be modified for the lifetime of the payload.
+    payload(const system::chunk_ptr& data) NOEXCEPT;
+
+    /// True if the payload has no data.
+    bool empty() const NOEXCEPT;
+
+    /// The size of the payload.
+    size_t size() const NOEXCEPT;
+
+    /// A view of the payload, valid for the lifetime of this object.
+    system::data_slice data() const NOEXCEPT;
+
+    /// A frame that references the payload (for sending).
+    frame to_frame() const NOEXCEPT;
+
+private:
+    // This is never modified, shared by all copies and all frames.
+    system::chunk_ptr data_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -21,8 +21,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
@@ -32,43 +34,131 @@ namespace zmq {
 
 /// This class is not thread safe.
 /// All calls must be made on the socket(s) thread.
+/// If zeromq draft APIs are enabled (--with-draft-api or -Denable-draft-api,
+/// and libzmq built with --enable-drafts) the poller is backed by zmq_poller,
+/// which retains registrations (epoll on Linux) so that the cost of a wait
+/// scales with the number of ready items. Otherwise it is backed by zmq_poll,
+/// which scans all registrations on each wait.
+/// Each registration is assigned an index, which is stable until removed and
+/// then reused by a subsequent add, so that a wait into a readiness result
+/// is allocation-free and readiness of a registration is tested by index.
 class BCP_API poller
   : public enable_shared_from_base<poller>
 {
 public:
-    DELETE_COPY_MOVE_DESTRUCT(poller);
+    DELETE_COPY_MOVE(poller);
 
     /// A shared poller pointer.
     typedef std::shared_ptr<poller> ptr;
 
+    /// Wait without timeout (use a wakeup to interrupt the wait).
+    static constexpr int32_t forever = -1;
+
+    /// Registration events, combined as flags (errors are always reported).
+    static constexpr short readable = ZMQ_POLLIN;
+    static constexpr short writable = ZMQ_POLLOUT;
+
     /// Construct an empty poller (sockets must be added).
     poller() NOEXCEPT;
 
+    /// Release the poller.
+    ~poller() NOEXCEPT;
+
     /// True if the timeout occurred.
     bool expired() const NOEXCEPT;
 
     /// True if the connection is closed.
     bool terminated() const NOEXCEPT;
 
-    /// Add a socket to be polled.
-    void add(socket& sock) NOEXCEPT;
+    /// Add a socket to be polled, false if already added or invalid.
+    bool add(socket& sock) NOEXCEPT;
+    bool add(socket& sock, size_t& index, short events=readable) NOEXCEPT;
+
+    /// Add a non-zeromq descriptor to be polled (e.g. pipe, eventfd, timerfd
+    /// or signalfd), false if already added. The descriptor is identified by
+    /// its value. On Windows only sockets may be polled.
+    bool add(file_descriptor descriptor) NOEXCEPT;
+    bool add(file_descriptor descriptor, size_t& index,
+        short events=readable) NOEXCEPT;
+
+    /// Change the polled events of a socket, false if not added. For example
+    /// add writable when a send returns try_again (high water mark) and
+    /// remove it once the pending message is sent.
+    bool modify(socket& sock, short events) NOEXCEPT;
+
+    /// Change the polled events of a descriptor, false if not added.
+    bool modify(file_descriptor descriptor, short events) NOEXCEPT;
+
+    /// Remove a socket from the poller, false if not added.
+    bool remove(socket& sock) NOEXCEPT;
+
+    /// Remove a descriptor from the poller, false if not added.
+    bool remove(file_descriptor descriptor) NOEXCEPT;
+
+    /// Get the registration index of a socket or descriptor, false if not
+    /// added.
+    bool find(socket& sock, size_t& index) const NOEXCEPT;
+    bool find(file_descriptor descriptor, size_t& index) const NOEXCEPT;
 
-    /// Remove all sockets from the poller.
+    /// Remove all sockets and descriptors from the poller.
     void clear() NOEXCEPT;
 
+    /// The number of sockets and descriptors added.
+    size_t size() const NOEXCEPT;
+
     /// Wait one second for any socket to receive.
     identifiers wait() NOEXCEPT;
 
     /// Wait specified time for any socket to receive, -1 is forever.
     identifiers wait(int32_t timeout_milliseconds) NOEXCEPT;
 
+    /// Wait specified time for any registration to be ready, -1 is forever.
+    /// The result is indexed by registration index and reports receive, send
+    /// and error readiness. True if any registration is ready.
+    bool wait(readiness& ready) NOEXCEPT;
+    bool wait(readiness& ready, int32_t timeout_milliseconds) NOEXCEPT;
+
 private:
+    typedef struct
+    {
+        void* socket;
+        file_descriptor fd;
+        bool used;
+    } registration;
+
+    typedef std::vector<registration> registrations;
+    typedef std::vector<size_t> indexes;
     typedef std::vector<zmq_pollitem> pollers;
+    typedef std::vector<zmq_poller_event> events;
+
+    bool add(void* socket, file_descriptor descriptor, size_t& index,
+        short events) NOEXCEPT;
+    bool modify(void* socket, file_descriptor descriptor,
+        short events) NOEXCEPT;
+    bool remove(void* socket, file_descriptor descriptor) NOEXCEPT;
+    bool find(void* socket, file_descriptor descriptor,
+        size_t& index) const NOEXCEPT;
+    bool poll(readiness& ready, int32_t timeout_milliseconds) NOEXCEPT;
 
     // These values are unprotected.
     bool expired_;
     bool terminated_;
+
+    // The zmq_poller (nullptr if zmq_poll) and its ready events buffer.
+    void* self_;
+    events events_;
+
+    // The registrations by index, and indexes available for reuse.
+    registrations registrations_;
+    indexes unused_;
+    size_t size_;
+
+    // The registrations and their indexes, retained only if zmq_poll.
     pollers pollers_;
+    indexes polled_;
+
+    // The result buffer for waits that return identifiers.
+    readiness ready_;
 };
 
 } // namespace zmq
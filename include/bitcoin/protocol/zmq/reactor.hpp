@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_REACTOR_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_REACTOR_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// An event loop on the worker thread. Sockets and descriptors are attached
+/// with handlers, and one-shot or periodic timers are scheduled (as a heap of
+/// deadlines), on the reactor thread. Each wait dispatches ready handlers
+/// round robin, each up to the batch limit, so that one busy registration
+/// cannot starve others. The loop waits without timeout until the next timer
+/// deadline and is woken immediately by stop. Derived classes must stop in
+/// their destructor, as open and close are called on the reactor thread.
+class BCP_API reactor
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(reactor);
+
+    /// A shared reactor pointer.
+    typedef std::shared_ptr<reactor> ptr;
+
+    /// Timer deadlines are monotonic and of poll resolution.
+    typedef std::chrono::steady_clock clock;
+    typedef std::chrono::milliseconds duration;
+
+    /// Handle signaled events (see readiness::events). Return true if more
+    /// work may be pending (e.g. a message was received without wait), and
+    /// the handler is called again in the same round, up to the batch limit.
+    typedef std::function<bool(short events)> handler;
+
+    /// Handle a timer expiration.
+    typedef std::function<void()> timer_handler;
+
+    /// The default maximum number of handler calls per registration per wait.
+    static constexpr size_t default_batch = 16;
+
+    /// Construct a reactor, with its thread optionally pinned to processors
+    /// and real-time scheduled (see worker).
+    reactor(size_t batch=default_batch,
+        thread_priority priority=thread_priority::normal,
+        const processors& affinity={},
+        const thread_schedule& schedule={}) NOEXCEPT;
+
+    /// Stop the reactor.
+    virtual ~reactor() NOEXCEPT;
+
+protected:
+    /// Called on the reactor thread before the loop, to create sockets and
+    /// to attach handlers and schedule timers. False fails start.
+    virtual bool open() NOEXCEPT = 0;
+
+    /// Called on the reactor thread after the loop (when stopped), to close
+    /// sockets. The result is returned by stop. Not called if start fails.
+    virtual bool close() NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Attach a socket or descriptor for the events, false if attached.
+    bool attach(socket& sock, handler&& callback,
+        short events=poller::readable) NOEXCEPT;
+    bool attach(file_descriptor descriptor, handler&& callback,
+        short events=poller::readable) NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Change the events of an attached socket or descriptor.
+    bool modify(socket& sock, short events) NOEXCEPT;
+    bool modify(file_descriptor descriptor, short events) NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Detach a socket or descriptor, false if not attached. The handler is
+    /// not called again, and a handler may detach its own registration.
+    bool detach(socket& sock) NOEXCEPT;
+    bool detach(file_descriptor descriptor) NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Schedule a one-shot timer, the identifier is valid until it expires.
+    size_t after(duration delay, timer_handler&& callback) NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Schedule a periodic timer (of at least one millisecond period). The
+    /// identifier is valid until cancelled. Missed periods are skipped.
+    size_t every(duration period, timer_handler&& callback) NOEXCEPT;
+
+    /// Call on the reactor thread (from open or a handler).
+    /// Cancel a timer, false if not scheduled (or expired one-shot).
+    bool cancel(size_t identifier) NOEXCEPT;
+
+    /// Run the loop until stopped.
+    void work() NOEXCEPT override;
+
+private:
+    typedef std::shared_ptr<handler> handler_ptr;
+    typedef std::shared_ptr<timer_handler> timer_ptr;
+
+    // A sequence distinguishes a registration from a prior one of its index.
+    typedef struct
+    {
+        handler_ptr callback;
+        uint64_t sequence;
+    } registration;
+
+    typedef struct
+    {
+        timer_ptr callback;
+        duration period;
+        uint64_t sequence;
+    } timer;
+
+    typedef struct
+    {
+        clock::time_point time;
+        size_t index;
+        uint64_t sequence;
+    } deadline;
+
+    typedef struct
+    {
+        size_t index;
+        uint64_t sequence;
+    } pending;
+
+    static bool later(const deadline& left, const deadline& right) NOEXCEPT;
+
+    size_t schedule(duration delay, duration period,
+        timer_handler&& callback) NOEXCEPT;
+    bool set_handler(size_t index, handler&& callback) NOEXCEPT;
+    void clear_handler(size_t index) NOEXCEPT;
+    void release(size_t identifier) NOEXCEPT;
+    bool invoke(const pending& item) NOEXCEPT;
+    int32_t timeout() NOEXCEPT;
+    void expire() NOEXCEPT;
+    void dispatch() NOEXCEPT;
+    void reset() NOEXCEPT;
+
+    // This is thread safe.
+    const size_t batch_;
+
+    // These are used only on the reactor thread.
+    poller poller_;
+    readiness ready_;
+    std::vector<registration> registrations_;
+    std::vector<pending> pending_;
+    std::vector<timer> timers_;
+    std::vector<size_t> unused_;
+    std::vector<deadline> deadlines_;
+    uint64_t sequence_;
+    size_t rotation_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
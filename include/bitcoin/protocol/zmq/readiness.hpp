@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_READINESS_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_READINESS_HPP
+
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// The result of a poller wait, indexed by the registration index assigned
+/// by poller::add, so that readiness of a registration is tested in constant
+/// time. Storage is retained across waits, so reuse avoids allocation (once
+/// grown to the registration count) and reset is proportional to the number
+/// of previously ready registrations.
+class BCP_API readiness
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(readiness);
+
+    /// The indexes of ready registrations, in order of signal.
+    typedef std::vector<size_t> indexes;
+    typedef indexes::const_iterator const_iterator;
+
+    /// Construct an empty result.
+    readiness() NOEXCEPT;
+
+    /// True if no registration is ready.
+    bool empty() const NOEXCEPT;
+
+    /// The number of ready registrations.
+    size_t size() const NOEXCEPT;
+
+    /// Iterate the indexes of ready registrations.
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+
+    /// True if the registration at index is ready for any event.
+    bool ready(size_t index) const NOEXCEPT;
+
+    /// True if the registration at index is ready to receive (POLLIN).
+    bool readable(size_t index) const NOEXCEPT;
+
+    /// True if the registration at index is ready to send (POLLOUT).
+    bool writable(size_t index) const NOEXCEPT;
+
+    /// True if the registration at index has an error (POLLERR).
+    bool failed(size_t index) const NOEXCEPT;
+
+    /// The zeromq events signaled for the registration at index (or zero).
+    short events(size_t index) const NOEXCEPT;
+
+    // Allow poller to clear the result for the registration count.
+    void reset(size_t registrations) NOEXCEPT;
+
+    // Allow poller to set the signaled zeromq events of a registration.
+    void set(size_t index, short events) NOEXCEPT;
+
+private:
+    std::vector<short> events_;
+    indexes ready_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SCHEDULER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SCHEDULER_HPP
+
+#include <coroutine>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/task.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// All calls must be made on the socket(s) thread.
+/// A single-threaded coroutine scheduler, so that multi-step exchanges may
+/// be written sequentially while any number interleave on one thread:
+///
+///     task exchange(scheduler& scheduler, socket& socket)
+///     {
+///         message request;
+///         if (co_await scheduler.receive(socket, request))
+///             co_return;
+///         ...
+///         co_await scheduler.send(socket, reply);
+///     }
+///
+/// An operation is first attempted without wait, and the task is suspended
+/// only if the operation would block. Suspended operations are registered
+/// with a poller by socket and attempted again when the socket is ready, so
+/// a task is resumed only once its operation has completed (or failed).
+/// Any number of tasks may await the same socket, and are resumed in order.
+class BCP_API scheduler
+{
+public:
+    DELETE_COPY_MOVE(scheduler);
+
+    /// This class is not thread safe.
+    /// An awaitable send or receive, the result of co_await is the code.
+    class BCP_API operation
+    {
+    public:
+        DELETE_COPY_MOVE(operation);
+
+        /// Attempt the operation without wait, true if it did not block.
+        bool await_ready() NOEXCEPT;
+
+        /// Suspend the task until the operation completes, false (resume)
+        /// if the socket cannot be polled (with the code set to failure).
+        bool await_suspend(task::handle handle) NOEXCEPT;
+
+        /// The result of the operation.
+        error::code await_resume() const NOEXCEPT;
+
+    private:
+        friend class scheduler;
+
+        operation(scheduler& owner, socket& socket, message& packet,
+            short events) NOEXCEPT;
+
+        bool attempt() NOEXCEPT;
+
+        scheduler& owner_;
+        socket& socket_;
+        message& packet_;
+        const short events_;
+        error::code ec_;
+        task::handle handle_;
+        operation* next_;
+    };
+
+    /// Construct an empty scheduler.
+    scheduler() NOEXCEPT;
+
+    /// Destroy any incomplete tasks (without resumption).
+    ~scheduler() NOEXCEPT;
+
+    /// Start the task, which runs until its first suspension (or completion).
+    void spawn(task&& coroutine) NOEXCEPT;
+
+    /// Await receipt of a message from the socket.
+    operation receive(socket& socket, message& packet) NOEXCEPT;
+
+    /// Await sending of a message to the socket.
+    operation send(socket& socket, message& packet) NOEXCEPT;
+
+    /// Wait once for any suspended operation to complete and resume its
+    /// task, -1 is forever. False if a socket was terminated.
+    bool run_one(int32_t timeout_milliseconds=poller::forever) NOEXCEPT;
+
+    /// Run until all tasks are complete. False if a socket was terminated or
+    /// if a task is suspended other than by an operation of this scheduler.
+    bool run() NOEXCEPT;
+
+    /// The number of incomplete tasks.
+    size_t size() const NOEXCEPT;
+
+private:
+    // Operations awaiting a socket, in order of suspension.
+    typedef struct
+    {
+        operation* head;
+        operation* tail;
+        socket* owner;
+        short events;
+    } waiters;
+
+    bool suspend(operation& waiter) NOEXCEPT;
+    void complete(size_t index) NOEXCEPT;
+    void resume(task::handle handle) NOEXCEPT;
+
+    // These are used only on the socket(s) thread.
+    poller poller_;
+    readiness ready_;
+    std::vector<waiters> waiters_;
+    std::vector<task::handle> tasks_;
+    std::vector<task::handle> resumable_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
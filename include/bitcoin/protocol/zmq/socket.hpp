@@ -20,6 +20,8 @@
 #define LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_HPP
 
 #include <memory>
+#include <span>
+#include <vector>
 #include <bitcoin/protocol/config/sodium.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/settings.hpp>
@@ -64,6 +66,9 @@ public:
     /// A shared socket pointer.
     typedef std::shared_ptr<socket> ptr;
 
+    /// A reusable batch of messages.
+    typedef std::vector<message> messages;
+
     /// Construct a socket from an existing zeromq socket.
     socket(void* zmq_socket) NOEXCEPT;
 
@@ -114,6 +119,13 @@ public:
     /// Apply the keys of the specified certificate to the socket.
     bool set_certificate(const certificate& certificate) NOEXCEPT;
 
+    /// Assign subsequent binds/connects to the context I/O threads selected
+    /// by the mask (bit n selects I/O thread n, 0 any).
+    bool set_io_thread_affinity(uint64_t mask) NOEXCEPT;
+
+    /// The current I/O thread affinity mask, zero if any or invalid socket.
+    uint64_t io_thread_affinity() const NOEXCEPT;
+
     /// Configure the socket to connect through the specified socks5 proxy.
     bool set_socks_proxy(const system::config::authority& socks_proxy) NOEXCEPT;
 
@@ -124,10 +136,26 @@ public:
     bool set_unsubscription(const system::data_chunk& filter) NOEXCEPT;
 
     /// Send a message on this socket.
-    error::code send(message& packet) NOEXCEPT;
+    /// If !wait returns try_again when the message cannot be sent now.
+    error::code send(message& packet, bool wait=true) NOEXCEPT;
+
+    /// Send messages on this socket in order, stopping at the first failure.
+    /// Sets count to the number of messages fully sent. Unsent parts remain
+    /// in the failed message (see message::send), later messages are intact.
+    error::code send_batch(std::span<message> batch, size_t& count,
+        bool wait=true) NOEXCEPT;
 
     /// Receive a message from this socket.
-    error::code receive(message& packet) NOEXCEPT;
+    /// If !wait returns try_again when no message is available.
+    error::code receive(message& packet, bool wait=true) NOEXCEPT;
+
+    /// Receive available messages from this socket without blocking.
+    /// Stops at maximum, sets count to the number of messages received.
+    /// Messages (and their part storage) are reused and the batch is never
+    /// shrunk, so only the first count messages of the batch are valid.
+    /// Returns try_again if no message was received, success if any were.
+    error::code receive_batch(messages& batch, size_t& count,
+        size_t maximum) NOEXCEPT;
 
 protected:
     static int to_socket_type(role socket_role) NOEXCEPT;
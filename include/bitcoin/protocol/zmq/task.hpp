@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_TASK_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// A coroutine run by a scheduler (see scheduler::spawn). The coroutine is
+/// suspended on creation and at completion, so that the scheduler controls
+/// its start and destroys it once done. The owner destroys an unspawned task.
+class task
+{
+public:
+    DELETE_COPY(task);
+
+    class promise_type
+    {
+    public:
+        task get_return_object() NOEXCEPT
+        {
+            return task{ handle::from_promise(*this) };
+        }
+
+        std::suspend_always initial_suspend() const NOEXCEPT
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const NOEXCEPT
+        {
+            return {};
+        }
+
+        void return_void() const NOEXCEPT
+        {
+        }
+
+        // Coroutine bodies are not permitted to throw.
+        void unhandled_exception() const NOEXCEPT
+        {
+            std::terminate();
+        }
+
+        /// The position of the task in its scheduler.
+        size_t position{};
+    };
+
+    /// The coroutine handle of a task.
+    typedef std::coroutine_handle<promise_type> handle;
+
+    /// Take ownership of the coroutine.
+    task(task&& other) NOEXCEPT
+      : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+
+    /// Take ownership of the coroutine.
+    task& operator=(task&& other) NOEXCEPT
+    {
+        if (this != &other)
+        {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+
+        return *this;
+    }
+
+    /// Destroy the coroutine if owned.
+    ~task() NOEXCEPT
+    {
+        reset();
+    }
+
+    /// Release ownership of the coroutine to the caller.
+    handle release() NOEXCEPT
+    {
+        return std::exchange(handle_, {});
+    }
+
+private:
+    explicit task(handle coroutine) NOEXCEPT
+      : handle_(coroutine)
+    {
+    }
+
+    void reset() NOEXCEPT
+    {
+        if (handle_)
+            handle_.destroy();
+
+        handle_ = {};
+    }
+
+    handle handle_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
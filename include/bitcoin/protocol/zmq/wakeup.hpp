@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_WAKEUP_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_WAKEUP_HPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// A pollable descriptor that any thread may signal, so that a poller can
+/// block indefinitely and still be woken immediately (e.g. to stop). Signals
+/// coalesce, any number of notifications are consumed by one clear. This is
+/// an eventfd on Linux, a pipe on other POSIX platforms and a loopback UDP
+/// socket on Windows (zmq_poll accepts only sockets there).
+class BCP_API wakeup
+{
+public:
+    DELETE_COPY_MOVE(wakeup);
+
+    /// Construct an unsignaled wakeup.
+    wakeup() NOEXCEPT;
+
+    /// Close the descriptor(s).
+    ~wakeup() NOEXCEPT;
+
+    /// True if the wakeup is valid.
+    operator bool() const NOEXCEPT;
+
+    /// The descriptor to poll for read (see poller::add).
+    file_descriptor descriptor() const NOEXCEPT;
+
+    /// Signal the descriptor readable, callable from any thread.
+    bool notify() NOEXCEPT;
+
+    /// Consume all pending signals, call on the polling thread.
+    void clear() NOEXCEPT;
+
+private:
+    // These are thread safe.
+    file_descriptor read_;
+    file_descriptor write_;
+
+#if defined(HAVE_MSC)
+    // This is set only on construct.
+    bool initialized_;
+#endif
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
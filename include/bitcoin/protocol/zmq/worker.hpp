@@ -23,11 +23,17 @@
 #include <memory>
 #include <future>
 #include <shared_mutex>
+#include <string>
 #include <thread>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/boost.hpp>
 #include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/wakeup.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -42,8 +48,29 @@ public:
     /// A shared worker pointer.
     typedef std::shared_ptr<worker> ptr;
 
-    /// Construct a worker.
-    worker(thread_priority priority=thread_priority::normal) NOEXCEPT;
+    /// Relay traffic counters for one side of the relay.
+    struct relay_counters
+    {
+        uint64_t messages_received;
+        uint64_t bytes_received;
+        uint64_t messages_sent;
+        uint64_t bytes_sent;
+    };
+
+    /// Relay traffic counters for both sides of the relay.
+    struct relay_statistics
+    {
+        relay_counters left;
+        relay_counters right;
+    };
+
+    /// Construct a worker, with its thread optionally pinned to processors
+    /// (see numa_processors) and real-time scheduled. A worker that cannot
+    /// be pinned or scheduled as specified fails to start. A real-time
+    /// schedule supersedes the priority.
+    worker(thread_priority priority=thread_priority::normal,
+        const processors& affinity={},
+        const thread_schedule& schedule={}) NOEXCEPT;
 
     /// Stop the worker.
     virtual ~worker() NOEXCEPT;
@@ -51,26 +78,69 @@ public:
     /// Start the worker.
     virtual bool start() NOEXCEPT;
 
-    /// Stop the worker (optional).
+    /// Stop the worker (optional), terminates a relay.
     virtual bool stop() NOEXCEPT;
 
+    /// Pause the relay (messages queue at the sockets), false if no relay.
+    bool pause() NOEXCEPT;
+
+    /// Resume the paused relay, false if no relay.
+    bool resume() NOEXCEPT;
+
+    /// Get the relay traffic counters, false if no relay.
+    bool statistics(relay_statistics& out) NOEXCEPT;
+
 protected:
     bool stopped() NOEXCEPT;
     bool started(bool result) NOEXCEPT;
     bool finished(bool result) NOEXCEPT;
     bool forward(socket& from, socket& to) NOEXCEPT;
+
+    /// Add the stop signal to the poller of the work loop, so that the loop
+    /// may wait forever and still observe stop immediately. A wait is woken
+    /// by stop, after which stopped() is true.
+    bool watch(poller& poller) NOEXCEPT;
+
+    /// Relay between sockets until context stop (not controllable or stopped
+    /// by stop, use the context overloads for control).
     void relay(socket& left, socket& right) NOEXCEPT;
 
+    /// Relay between sockets of the context until stop or context stop.
+    /// A capture socket receives a copy of all relayed messages.
+    /// True if the relay was terminated by stop.
+    bool relay(context& context, socket& left, socket& right) NOEXCEPT;
+    bool relay(context& context, socket& left, socket& right,
+        socket& capture) NOEXCEPT;
+
     virtual void work() = 0;
 
 private:
+    void run() NOEXCEPT;
+    bool proxy(context& context, socket& left, socket& right,
+        void* capture) NOEXCEPT;
+    bool publish(context* relay_context) NOEXCEPT;
+    bool control(const std::string& command, message& reply) NOEXCEPT;
+
     // These are protected by mutex.
     std::atomic<bool> stopped_;
     std::promise<bool> started_;
     std::promise<bool> finished_;
     std::shared_ptr<std::thread> thread_;
     const thread_priority priority_;
+    const processors affinity_;
+    const thread_schedule schedule_;
     mutable std::shared_mutex mutex_;
+
+    // This is used only on the worker thread.
+    bool configured_;
+
+    // These are thread safe.
+    wakeup wakeup_;
+    const std::string control_endpoint_;
+
+    // This is protected by relay mutex, and is valid only while published.
+    context* relay_context_;
+    mutable std::shared_mutex relay_mutex_;
 };
 
 } // namespace zmq
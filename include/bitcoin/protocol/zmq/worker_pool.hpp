@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_WORKER_POOL_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_WORKER_POOL_HPP
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Requests received on the front (router) endpoint are relayed over an
+/// inproc dealer to a set of replier threads, each with its own socket.
+/// zeromq load balances requests across idle repliers, and replies are
+/// routed back to the requester. Derive to implement handle().
+class BCP_API worker_pool
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(worker_pool);
+
+    /// A shared worker pool pointer.
+    typedef std::shared_ptr<worker_pool> ptr;
+
+    /// Construct a pool of the given number of replier threads (one per core
+    /// by default). The context must outlive the pool. All pool threads are
+    /// pinned to the affinity processors, if any, and scheduled alike.
+    worker_pool(context& context, const system::config::endpoint& endpoint,
+        size_t threads=cores(),
+        thread_priority priority=thread_priority::normal,
+        const processors& affinity={},
+        const thread_schedule& schedule={}) NOEXCEPT;
+
+    /// Stop the pool.
+    virtual ~worker_pool() NOEXCEPT;
+
+    /// Start the relay and then all repliers, false if any fails to start
+    /// (in which case all are stopped).
+    virtual bool start() NOEXCEPT override;
+
+    /// Stop the relay and then all repliers, false if any fails to stop.
+    virtual bool stop() NOEXCEPT override;
+
+    /// The number of replier threads.
+    size_t threads() const NOEXCEPT;
+
+protected:
+    /// Called on any replier thread, must be thread safe.
+    /// Handle the request by populating the reply. An empty reply is sent as
+    /// a single empty part, as every request must be answered.
+    virtual void handle(message& request, message& reply) NOEXCEPT = 0;
+
+    /// Relay the front router to the inproc dealer.
+    void work() NOEXCEPT override;
+
+private:
+    class replier;
+
+    context& context_;
+    const system::config::endpoint endpoint_;
+    const std::string backend_;
+    const thread_priority priority_;
+    const processors affinity_;
+    const thread_schedule schedule_;
+
+    // These are protected by mutex.
+    std::vector<std::shared_ptr<replier>> repliers_;
+    mutable std::shared_mutex mutex_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
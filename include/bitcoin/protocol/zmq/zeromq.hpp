@@ -41,9 +41,9 @@ constexpr size_t zmq_encoded_key_size = 40;
 // This is the maximum safe value on all platforms, due to zeromq bug.
 constexpr int32_t zmq_maximum_safe_wait_milliseconds = 1000;
 
-// If ZMQ_DONTWAIT is set we fail on busy socket.
-// This would happen if a message is being read when we try to send.
-constexpr int32_t wait_flag = 0;
+// Payloads up to this size are stored within zmq_msg_t (no allocation).
+// This is the zeromq "very small message" limit for 64 bit platforms.
+constexpr size_t zmq_maximum_inline_size = 33;
 
 /// zmq_msg_t alias, keeps zmq.h out of our headers.
 /// Conditions are based on zeromq declarations.
@@ -77,6 +77,16 @@ typedef struct zmq_pollitem
     short revents;
 } zmq_pollitem;
 
+/// zmq_poller_event_t alias, keeps zmq.h out of our headers.
+/// The zmq_poller API is draft in zeromq 4.3 (see poller).
+typedef struct zmq_poller_event
+{
+    void* socket;
+    file_descriptor fd;
+    void* user_data;
+    short events;
+} zmq_poller_event;
+
 } // namespace zmq
 } // namespace protocol
 } // namespace libbitcoin
@@ -18,7 +18,9 @@
  */
 #include <bitcoin/protocol/settings.hpp>
 
+#include <algorithm>
 #include <bitcoin/system.hpp>
+#include <bitcoin/protocol/network.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -33,7 +35,8 @@ settings::settings() NOEXCEPT
     ping_seconds(0),
     inactivity_seconds(0),
     reconnect_seconds(1),
-    send_milliseconds(0)
+    send_milliseconds(0),
+    io_thread_affinity(0)
 {
 }
 
@@ -41,12 +44,26 @@ settings::settings(uint32_t send_high_water,
     uint32_t receive_high_water) NOEXCEPT
   : send_high_water(send_high_water),
     receive_high_water(receive_high_water),
-    message_size_limit(0), 
+    message_size_limit(0),
     handshake_seconds(30),
     ping_seconds(0),
     inactivity_seconds(0),
     reconnect_seconds(1),
-    send_milliseconds(0)
+    send_milliseconds(0),
+    io_thread_affinity(0)
+{
+}
+
+// zeromq recommends one I/O thread per gigabyte per second of throughput,
+// which CURVE encryption reduces to about one per few cores, so the default is
+// io_threads = max(cores / 4, 1). Other values are the zeromq defaults.
+context_settings::context_settings() NOEXCEPT
+  : io_threads(limit<uint32_t>(std::max(cores() / 4u, one))),
+    maximum_sockets(1023),
+    maximum_message_size(0),
+    zero_copy_receive(true),
+    io_affinity(),
+    io_schedule()
 {
 }
 
@@ -25,6 +25,7 @@
 #include <bitcoin/protocol/zmq/message.hpp>
 #include <bitcoin/protocol/zmq/context.hpp>
 #include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 #include <bitcoin/protocol/zmq/worker.hpp>
 
@@ -88,16 +89,18 @@ bool authenticator::stop() NOEXCEPT
 void authenticator::work() NOEXCEPT
 {
     socket replier(context_, zmq::socket::role::replier);
+    size_t replied{};
+    readiness ready;
+    poller poller;
 
-    if (!started(replier.bind(authentication_point) == error::success))
+    // The poller waits forever, so a failure to watch for stop fails start.
+    if (!started(replier.bind(authentication_point) == error::success &&
+        poller.add(replier, replied) && watch(poller)))
         return;
 
-    poller poller;
-    poller.add(replier);
-
     while (!poller.terminated() && !stopped())
     {
-        if (!poller.wait().contains(replier.id()))
+        if (!poller.wait(ready, poller::forever) || !ready.readable(replied))
             continue;
 
         std::string version;
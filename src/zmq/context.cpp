@@ -19,7 +19,10 @@
 #include <bitcoin/protocol/zmq/context.hpp>
 
 #include <mutex>
+#include <thread>
 #include <bitcoin/system.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/settings.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
 namespace libbitcoin {
@@ -28,8 +31,34 @@ namespace zmq {
 
 using namespace bc::system;
 
+// zeromq asserts if it cannot pin or schedule an I/O thread, so each is first
+// applied to a transient thread and a failure is reported by the caller.
+template <typename Configure>
+static bool probe(const Configure& configure) NOEXCEPT
+{
+    auto result = false;
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::thread thread([&]() NOEXCEPT { result = configure(); });
+    thread.join();
+    BC_POP_WARNING()
+    return result;
+}
+
+// Constructed on use, so valid for a context of static storage duration.
+static context_settings zeromq_settings() NOEXCEPT
+{
+    context_settings settings{};
+    settings.io_threads = 1;
+    return settings;
+}
+
 context::context(bool started) NOEXCEPT
-  : self_(nullptr)
+  : context(started, zeromq_settings())
+{
+}
+
+context::context(bool started, const context_settings& settings) NOEXCEPT
+  : self_(nullptr), settings_(settings)
 {
     if (started)
         start();
@@ -52,8 +81,20 @@ bool context::start() NOEXCEPT
     if (self_ != nullptr)
         return false;
 
-    self_.store(zmq_ctx_new());
-    return self_ != nullptr;
+    const auto self = zmq_ctx_new();
+
+    if (self == nullptr)
+        return false;
+
+    // A context that cannot be configured is terminated (it has no sockets).
+    if (!configure(self))
+    {
+        zmq_ctx_term(self);
+        return false;
+    }
+
+    self_.store(self);
+    return true;
     ///////////////////////////////////////////////////////////////////////////
 }
 
@@ -83,6 +124,60 @@ context::operator bool() const NOEXCEPT
     return self_ != nullptr;
 }
 
+// private
+// I/O threads are created by the first socket, so options apply to all.
+bool context::configure(void* self) const NOEXCEPT
+{
+    const auto set = [self](int32_t option, int32_t value) NOEXCEPT
+    {
+        return zmq_ctx_set(self, option, value) != zmq_fail;
+    };
+
+    const auto size = limit<int32_t>(settings_.maximum_message_size);
+
+    if (!set(ZMQ_IO_THREADS, limit<int32_t>(settings_.io_threads)) ||
+        !set(ZMQ_MAX_SOCKETS, limit<int32_t>(settings_.maximum_sockets)) ||
+        !set(ZMQ_MAX_MSGSZ, is_zero(size) ? max_int32 : size))
+        return false;
+
+    // ZMQ_ZERO_COPY_RECV is defined by zeromq 4.3 only for the draft API,
+    // otherwise zero copy receive is always on and cannot be disabled.
+#if defined(ZMQ_ZERO_COPY_RECV)
+    if (!set(ZMQ_ZERO_COPY_RECV, settings_.zero_copy_receive ? zmq_true :
+        zmq_false))
+        return false;
+#else
+    if (!settings_.zero_copy_receive)
+        return false;
+#endif
+
+    const auto& affinity = settings_.io_affinity;
+
+    // A processor that is offline or does not exist fails here.
+    if (!affinity.empty() &&
+        !probe([&]() NOEXCEPT { return set_affinity(affinity); }))
+        return false;
+
+    for (const auto cpu: affinity)
+    {
+        if (cpu > to_unsigned(max_int32))
+            return false;
+
+        const auto processor = possible_narrow_sign_cast<int32_t>(cpu);
+        if (!set(ZMQ_THREAD_AFFINITY_CPU_ADD, processor))
+            return false;
+    }
+
+    const auto& schedule = settings_.io_schedule;
+
+    if (schedule.policy == thread_policy::normal)
+        return true;
+
+    return probe([&]() NOEXCEPT { return set_schedule(schedule); }) &&
+        set(ZMQ_THREAD_SCHED_POLICY, get_policy(schedule.policy)) &&
+        set(ZMQ_THREAD_PRIORITY, schedule.priority);
+}
+
 // This may become invalid after return. This call only ensures atomicity.
 void* context::self() NOEXCEPT
 {
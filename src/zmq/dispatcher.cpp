@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/dispatcher.hpp>
+
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/wakeup.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+dispatcher::dispatcher(context& context, const config::endpoint& endpoint,
+    size_t threads, thread_priority priority,
+    const processors& affinity, const thread_schedule& schedule) NOEXCEPT
+  : worker(priority, affinity, schedule),
+    context_(context),
+    endpoint_(endpoint),
+    executor_(threads, priority, affinity, schedule)
+{
+}
+
+dispatcher::~dispatcher() NOEXCEPT
+{
+    stop();
+}
+
+size_t dispatcher::threads() const NOEXCEPT
+{
+    return executor_.threads();
+}
+
+// Receive and dispatch on the socket thread until stopped.
+// The completion wakeup is signaled by handler threads when the completion
+// queue becomes non-empty, and the worker wakeup is signaled by stop, so the
+// socket thread waits without timeout.
+void dispatcher::work() NOEXCEPT
+{
+    socket router(context_, socket::role::router);
+
+    if (!router || !completed_ || router.bind(endpoint_) ||
+        !executor_.start())
+    {
+        started(false);
+        return;
+    }
+
+    // Request and result storage is retained across requests.
+    size_t routed{};
+    size_t completed{};
+    message request;
+    readiness ready;
+    poller poller;
+
+    // The poller waits forever, so a failure to watch for stop fails start.
+    if (!started(poller.add(router, routed) &&
+        poller.add(completed_.descriptor(), completed) && watch(poller)))
+    {
+        executor_.stop();
+        return;
+    }
+
+    while (!poller.terminated() && !stopped())
+    {
+        if (!poller.wait(ready, poller::forever))
+            continue;
+
+        // Signals are coalesced, any number are consumed by one drain.
+        if (ready.readable(completed))
+            completed_.clear();
+
+        // Requests are received in batches, so that sustained requests do not
+        // starve replies. Remaining requests leave the router readable.
+        if (ready.readable(routed))
+        {
+            for (size_t received = 0; received < receive_batch &&
+                !request.receive(router, false); ++received)
+                dispatch(std::move(request));
+        }
+
+        drain(router);
+    }
+
+    // Handlers are joined before remaining replies are sent.
+    executor_.stop();
+    completed_.clear();
+    drain(router);
+    finished(router.stop());
+}
+
+// private
+// Called on the socket thread, the envelope is split from the request here so
+// that the handler sees only the request body. The identity is generated by
+// the router or set by the client (ZMQ_ROUTING_ID), so its size varies.
+void dispatcher::dispatch(message&& request) NOEXCEPT
+{
+    message reply;
+    data_chunk identity{};
+
+    // A router always prefixes the identity, discard the request if invalid.
+    if (!request.dequeue(identity) || identity.empty())
+        return;
+
+    reply.enqueue(std::move(identity));
+
+    // A requester client adds an empty delimiter, a dealer client may not.
+    if (!request.empty() && request.front().empty())
+    {
+        request.dequeue();
+        reply.enqueue();
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    executor_.submit([this, request = std::move(request),
+        reply = std::move(reply)]() mutable NOEXCEPT
+    {
+        handle(request, reply);
+        complete(std::move(reply));
+    });
+    BC_POP_WARNING()
+}
+
+// private
+// Called on a handler thread, the socket thread is signaled only when the
+// queue becomes non-empty (a non-empty queue is pending a drain).
+void dispatcher::complete(message&& reply) NOEXCEPT
+{
+    if (completions_.push(std::move(reply)))
+        completed_.notify();
+}
+
+// private
+// Called on the socket thread, replies are sent in completion order.
+void dispatcher::drain(socket& router) NOEXCEPT
+{
+    completions_.drain([&router](message& reply) NOEXCEPT
+    {
+        router.send(reply);
+    });
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
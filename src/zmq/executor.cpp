@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/executor.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// The executor and queue index of the current thread, if an executor thread.
+static thread_local const executor* current_executor{ nullptr };
+static thread_local size_t current_index{};
+
+template <typename Queue>
+static std::vector<std::unique_ptr<Queue>> make_queues(size_t count) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<std::unique_ptr<Queue>> queues{};
+    queues.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+        queues.push_back(std::make_unique<Queue>());
+    BC_POP_WARNING()
+
+    return queues;
+}
+
+executor::executor(size_t threads, thread_priority priority,
+    const processors& affinity, const thread_schedule& schedule) NOEXCEPT
+  : count_(std::max(threads, one)),
+    priority_(priority),
+    affinity_(affinity),
+    schedule_(schedule),
+    queues_(make_queues<queue>(count_)),
+    stopped_(true),
+    unconfigured_(false),
+    pending_(zero),
+    next_(zero)
+{
+}
+
+executor::~executor() NOEXCEPT
+{
+    stop();
+}
+
+size_t executor::threads() const NOEXCEPT
+{
+    return count_;
+}
+
+// Restartable after stop and not started on construct.
+bool executor::start() NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unique_lock lock(mutex_);
+    BC_POP_WARNING()
+
+    if (!stopped_)
+        return false;
+
+    // The queues were cleared by halt, and submit rejects while stopped.
+    stopped_ = false;
+    unconfigured_ = false;
+
+    // Wait on all threads to be pinned and scheduled (or not).
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::latch configured{ possible_narrow_sign_cast<ptrdiff_t>(count_) };
+    threads_.reserve(count_);
+    for (size_t index = 0; index < count_; ++index)
+        threads_.emplace_back(&executor::run, this, index,
+            std::ref(configured));
+    configured.wait();
+    BC_POP_WARNING()
+
+    if (!unconfigured_)
+        return true;
+
+    halt();
+    return false;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+bool executor::stop() NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unique_lock lock(mutex_);
+    BC_POP_WARNING()
+
+    if (!stopped_)
+        halt();
+
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+bool executor::submit(task&& work) NOEXCEPT
+{
+    if (stopped_)
+        return false;
+
+    // Keep a task submitted from an executor thread local to that thread.
+    const auto index = current_executor == this ? current_index :
+        next_++ % count_;
+
+    // Stopped is checked again under the queue lock, which clear also takes,
+    // so a task is never queued after (or while) the queues are cleared.
+    // Counted before it is queued, so that pending never underflows.
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        auto& target = *queues_.at(index);
+        std::unique_lock lock(target.mutex);
+
+        if (stopped_)
+            return false;
+
+        ++pending_;
+        target.tasks.push_back(std::move(work));
+        BC_POP_WARNING()
+    }
+
+    // Taking the idle mutex orders the task before any idle thread's check
+    // of pending, so the notification cannot be missed.
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::unique_lock idle(idle_mutex_);
+        BC_POP_WARNING()
+    }
+
+    idle_.notify_one();
+    return true;
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+// Called under the mutex, stop and join the threads.
+void executor::halt() NOEXCEPT
+{
+    // Set under the idle mutex so that no thread misses the notification.
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::unique_lock idle(idle_mutex_);
+        BC_POP_WARNING()
+        stopped_ = true;
+    }
+
+    idle_.notify_all();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    for (auto& thread: threads_)
+        thread.join();
+    BC_POP_WARNING()
+
+    threads_.clear();
+    clear();
+}
+
+// The thread is pinned before it allocates, so that memory is first touched
+// (and so placed) on the NUMA node of the pinned processors.
+void executor::run(size_t index, std::latch& configured) NOEXCEPT
+{
+    if (!set_affinity(affinity_) || !set_schedule(schedule_))
+        unconfigured_ = true;
+
+    configured.count_down();
+    current_executor = this;
+    current_index = index;
+
+    // A real-time schedule supersedes priority (as in worker).
+    if (schedule_.policy == thread_policy::normal)
+        set_priority(priority_);
+
+    task work{};
+    while (!stopped_)
+    {
+        // A failed sweep may have skipped a locked queue, so that a pending
+        // task is found only by waiting on the queue locks.
+        if (pop(index, work) || steal(index, work, false) ||
+            steal(index, work, true))
+        {
+            --pending_;
+            work();
+            work = nullptr;
+            continue;
+        }
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::unique_lock idle(idle_mutex_);
+        idle_.wait(idle, [this]() NOEXCEPT
+        {
+            return stopped_ || is_nonzero(pending_.load());
+        });
+        BC_POP_WARNING()
+    }
+
+    current_executor = nullptr;
+}
+
+// The owner runs its most recent task first.
+bool executor::pop(size_t index, task& out) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    auto& source = *queues_.at(index);
+    std::unique_lock lock(source.mutex);
+    BC_POP_WARNING()
+
+    if (source.tasks.empty())
+        return false;
+
+    out = std::move(source.tasks.back());
+    source.tasks.pop_back();
+    return true;
+}
+
+// A thief takes the oldest task of the next non-empty queue. Unless waiting,
+// a queue that is locked by its owner or another thief is skipped.
+bool executor::steal(size_t index, task& out, bool wait) NOEXCEPT
+{
+    for (size_t offset = 1; offset < count_; ++offset)
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        auto& source = *queues_.at((index + offset) % count_);
+        std::unique_lock lock(source.mutex, std::defer_lock);
+
+        if (wait)
+            lock.lock();
+        else if (!lock.try_lock())
+            continue;
+        BC_POP_WARNING()
+
+        if (source.tasks.empty())
+            continue;
+
+        out = std::move(source.tasks.front());
+        source.tasks.pop_front();
+        return true;
+    }
+
+    return false;
+}
+
+// Called only when stopped and no threads are running, but a submit that
+// preceded the stop may still hold a queue lock.
+void executor::clear() NOEXCEPT
+{
+    for (const auto& source: queues_)
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::unique_lock lock(source->mutex);
+        BC_POP_WARNING()
+
+        pending_ -= source->tasks.size();
+        source->tasks.clear();
+    }
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
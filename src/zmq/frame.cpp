@@ -20,6 +20,7 @@
 
 #include <cstring>
 #include <iterator>
+#include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
@@ -34,36 +35,186 @@ using namespace bc::system;
 
 // Use for receiving.
 frame::frame() NOEXCEPT
-  : more_(false), valid_(initialize({}))
+  : more_(false), valid_(initialize(data_slice{}))
+{
+}
+
+// Use for writing in place and then sending.
+frame::frame(size_t size) NOEXCEPT
+  : more_(false), valid_(initialize(size))
 {
 }
 
 // Use for sending.
-frame::frame(const system::data_chunk& data) NOEXCEPT
+frame::frame(const system::data_slice& data) NOEXCEPT
   : more_(false), valid_(initialize(data))
 {
 }
 
+// Use for sending without copy.
+frame::frame(system::data_chunk&& data) NOEXCEPT
+  : more_(false), valid_(initialize(std::move(data)))
+{
+}
+
+// Use for sending without copy.
+frame::frame(const system::chunk_ptr& data) NOEXCEPT
+  : more_(false), valid_(initialize(data))
+{
+}
+
+// The other frame remains valid but is emptied.
+frame::frame(frame&& other) NOEXCEPT
+  : more_(other.more_),
+    valid_(initialize(data_slice{}) && other.valid_ && move(other))
+{
+}
+
+// Large payloads are reference counted by zeromq, not copied.
+frame::frame(const frame& other) NOEXCEPT
+  : more_(other.more_),
+    valid_(initialize(data_slice{}) && other.valid_ && copy(other))
+{
+}
+
+frame& frame::operator=(frame&& other) NOEXCEPT
+{
+    if (this != &other)
+    {
+        destroy();
+        more_ = other.more_;
+        valid_ = initialize(data_slice{}) && other.valid_ && move(other);
+    }
+
+    return *this;
+}
+
+frame& frame::operator=(const frame& other) NOEXCEPT
+{
+    if (this != &other)
+    {
+        destroy();
+        more_ = other.more_;
+        valid_ = initialize(data_slice{}) && other.valid_ && copy(other);
+    }
+
+    return *this;
+}
+
 frame::~frame() NOEXCEPT
 {
     destroy();
 }
 
 // private
-bool frame::initialize(const data_chunk& data) NOEXCEPT
+bool frame::initialize(size_t size) NOEXCEPT
 {
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
 
-    if (data.empty())
+    if (is_zero(size))
         return (zmq_msg_init(buffer) != zmq_fail);
 
-    if (zmq_msg_init_size(buffer, data.size()) == zmq_fail)
+    return (zmq_msg_init_size(buffer, size) != zmq_fail);
+}
+
+// private
+bool frame::initialize(const data_slice& data) NOEXCEPT
+{
+    if (!initialize(data.size()))
         return false;
 
+    if (data.empty())
+        return true;
+
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+
     std::memcpy(zmq_msg_data(buffer), data.data(), data.size());
     return true;
 }
 
+// private
+bool frame::initialize(data_chunk&& data) NOEXCEPT
+{
+    // An inline copy is cheaper than a heap allocation for the owner.
+    if (data.size() <= zmq_maximum_inline_size)
+        return initialize(data);
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto owner = new data_chunk(std::move(data));
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    // zeromq invokes free_chunk (on any thread) once the frame is released.
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+
+    if (zmq_msg_init_data(buffer, owner->data(), owner->size(), &free_chunk,
+        owner) != zmq_fail)
+        return true;
+
+    free_chunk(nullptr, owner);
+    return false;
+}
+
+// private
+bool frame::initialize(const chunk_ptr& data) NOEXCEPT
+{
+    if (!data)
+        return initialize(data_slice{});
+
+    // An inline copy is cheaper than a heap allocation for the reference.
+    if (data->size() <= zmq_maximum_inline_size)
+        return initialize(*data);
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto reference = new chunk_ptr(data);
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    // zeromq invokes free_shared (on any thread) once the frame is released.
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+
+    if (zmq_msg_init_data(buffer, data->data(), data->size(), &free_shared,
+        reference) != zmq_fail)
+        return true;
+
+    free_shared(nullptr, reference);
+    return false;
+}
+
+// private static
+void frame::free_chunk(void*, void* hint) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete pointer_cast<data_chunk>(hint);
+    BC_POP_WARNING()
+}
+
+// private static
+void frame::free_shared(void*, void* hint) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete pointer_cast<chunk_ptr>(hint);
+    BC_POP_WARNING()
+}
+
+// private
+bool frame::move(frame& other) NOEXCEPT
+{
+    const auto& from = pointer_cast<zmq_msg_t>(&other.message_);
+    const auto& to = pointer_cast<zmq_msg_t>(&message_);
+    return zmq_msg_move(to, from) != zmq_fail;
+}
+
+// private
+bool frame::copy(const frame& other) NOEXCEPT
+{
+    const auto& from = pointer_cast<zmq_msg_t>(&other.message_);
+    const auto& to = pointer_cast<zmq_msg_t>(&message_);
+    return zmq_msg_copy(to, from) != zmq_fail;
+}
+
 // private
 bool frame::destroy() NOEXCEPT
 {
@@ -94,8 +245,37 @@ bool frame::set_more(socket& socket) NOEXCEPT
     return true;
 }
 
+size_t frame::size() const NOEXCEPT
+{
+    if (!valid_)
+        return zero;
+
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    return zmq_msg_size(buffer);
+}
+
+data_slice frame::data() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    const auto size = zmq_msg_size(buffer);
+    const auto data = zmq_msg_data(buffer);
+    const auto begin = pointer_cast<uint8_t>(data);
+    return { begin, std::next(begin, size) };
+}
+
 data_chunk frame::payload() const NOEXCEPT
 {
+    return to_chunk(data());
+}
+
+data_slab frame::buffer() NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
     const auto size = zmq_msg_size(buffer);
     const auto data = zmq_msg_data(buffer);
@@ -104,24 +284,25 @@ data_chunk frame::payload() const NOEXCEPT
 }
 
 // Must be called on the socket thread.
-error::code frame::receive(socket& socket) NOEXCEPT
+error::code frame::receive(socket& socket, bool wait) NOEXCEPT
 {
     if (!valid_)
         return error::invalid_message;
 
+    const int flags = wait ? 0 : ZMQ_DONTWAIT;
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
-    const auto result = zmq_msg_recv(buffer, socket.self(), wait_flag)
+    const auto result = zmq_msg_recv(buffer, socket.self(), flags)
         != zmq_fail && set_more(socket);
     return result ? error::success : error::get_last_error();
 }
 
 // Must be called on the socket thread.
-error::code frame::send(socket& socket, bool last) NOEXCEPT
+error::code frame::send(socket& socket, bool last, bool wait) NOEXCEPT
 {
     if (!valid_)
         return error::invalid_message;
 
-    const int flags = (last ? 0 : ZMQ_SNDMORE) | wait_flag;
+    const int flags = (last ? 0 : ZMQ_SNDMORE) | (wait ? 0 : ZMQ_DONTWAIT);
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
     const auto result = zmq_msg_send(buffer, socket.self(), flags) != zmq_fail;
     return result ? error::success : error::get_last_error();
@@ -46,6 +46,11 @@ void identifiers::push(const void* socket) NOEXCEPT
     ids_.push_back(reinterpret_cast<identifier>(socket));
 }
 
+void identifiers::push(identifier descriptor) NOEXCEPT
+{
+    ids_.push_back(descriptor);
+}
+
 } // namespace zmq
 } // namespace protocol
 } // namespace libbitcoin
@@ -19,10 +19,12 @@
 #include <bitcoin/protocol/zmq/message.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
 #include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/payload.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -31,172 +33,383 @@ namespace zmq {
 using namespace bc::system;
 
 message::message() NOEXCEPT
-  : queue_{}
+  : message(std::pmr::get_default_resource())
 {
 }
 
+message::message(std::pmr::memory_resource* resource) NOEXCEPT
+  : parts_(resource), offset_(zero)
+{
+}
+
+// The offset is reset with the parts, otherwise the moved-from size wraps.
+message::message(message&& other) NOEXCEPT
+  : parts_(std::move(other.parts_)),
+    offset_(std::exchange(other.offset_, zero))
+{
+    other.parts_.clear();
+}
+
+// Parts are moved individually if the memory resources differ.
+message& message::operator=(message&& other) NOEXCEPT
+{
+    if (this == &other)
+        return *this;
+
+    parts_ = std::move(other.parts_);
+    offset_ = std::exchange(other.offset_, zero);
+    other.parts_.clear();
+    return *this;
+}
+
 void message::enqueue() NOEXCEPT
 {
-    queue_.emplace();
+    parts_.emplace_back();
 }
 
+// The part buffer is adopted by zeromq, not copied.
 void message::enqueue(data_chunk&& value) NOEXCEPT
 {
-    queue_.push(std::move(value));
+    parts_.emplace_back(std::move(value));
 }
 
 void message::enqueue(const data_chunk& value) NOEXCEPT
 {
-    queue_.push(value);
+    parts_.emplace_back(value);
 }
 
 void message::enqueue(const std::string& value) NOEXCEPT
 {
-    queue_.push(to_chunk(value));
+    parts_.emplace_back(value);
 }
 
 void message::enqueue(const address& value) NOEXCEPT
 {
-    queue_.push(to_chunk(value));
+    parts_.emplace_back(value);
+}
+
+// The part references the shared payload buffer, it is not copied.
+void message::enqueue(const payload& value) NOEXCEPT
+{
+    parts_.emplace_back(value.to_frame());
 }
 
 bool message::dequeue() NOEXCEPT
 {
-    if (queue_.empty())
+    if (empty())
         return false;
 
-    queue_.pop();
+    pop();
     return true;
 }
 
 bool message::dequeue(data_chunk& value) NOEXCEPT
 {
-    if (queue_.empty())
-        return false;
-
-    value = dequeue_data();
-    return true;
+    return assign(value);
 }
 
 bool message::dequeue(std::string& value) NOEXCEPT
 {
-    if (queue_.empty())
-        return false;
+    return assign(value);
+}
 
-    value = dequeue_text();
-    return true;
+bool message::dequeue(pmr_chunk& value) NOEXCEPT
+{
+    return assign(value);
+}
+
+bool message::dequeue(std::pmr::string& value) NOEXCEPT
+{
+    return assign(value);
 }
 
 bool message::dequeue(address& value) NOEXCEPT
 {
-    if (queue_.empty())
+    if (empty())
         return false;
 
-    const auto& front = queue_.front();
+    const auto& front = top();
 
     if (front.size() == address_size)
     {
-        std::copy(front.begin(), front.end(), value.begin());
-        queue_.pop();
+        const auto data = front.data();
+        std::copy(data.begin(), data.end(), value.begin());
+        pop();
         return true;
     }
 
-    queue_.pop();
+    pop();
     return false;
 }
 
 // Used by ZAP for public/private key read/write.
 bool message::dequeue(hash_digest& value) NOEXCEPT
 {
-    if (queue_.empty())
+    if (empty())
         return false;
 
-    const auto& front = queue_.front();
+    const auto& front = top();
 
     if (front.size() == hash_size)
     {
-        std::copy(front.begin(), front.end(), value.begin());
-        queue_.pop();
+        const auto data = front.data();
+        std::copy(data.begin(), data.end(), value.begin());
+        pop();
         return true;
     }
 
-    queue_.pop();
+    pop();
     return false;
 }
 
+data_slice message::front() const NOEXCEPT
+{
+    if (empty())
+        return {};
+
+    return top().data();
+}
+
+data_slice message::part(size_t index) const NOEXCEPT
+{
+    if (index >= size())
+        return {};
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return parts_[offset_ + index].data();
+    BC_POP_WARNING()
+}
+
+message::const_iterator message::begin() const NOEXCEPT
+{
+    return std::next(parts_.begin(), offset_);
+}
+
+message::const_iterator message::end() const NOEXCEPT
+{
+    return parts_.end();
+}
+
+// This is the only copy of a received part.
 data_chunk message::dequeue_data() NOEXCEPT
 {
-    if (queue_.empty())
+    if (empty())
         return {};
 
-    const auto data = queue_.front();
-    queue_.pop();
+    auto data = top().payload();
+    pop();
     return data;
 }
 
+// This is the only copy of a received part.
 std::string message::dequeue_text() NOEXCEPT
 {
-    if (queue_.empty())
+    if (empty())
         return {};
 
-    auto text = to_string(queue_.front());
-    queue_.pop();
+    auto text = to_string(top().data());
+    pop();
     return text;
 }
 
+// Part storage is retained for reuse.
 void message::clear() NOEXCEPT
 {
-    while (!queue_.empty())
-        queue_.pop();
+    parts_.clear();
+    offset_ = zero;
 }
 
 bool message::empty() const NOEXCEPT
 {
-    return queue_.empty();
+    return offset_ == parts_.size();
 }
 
 size_t message::size() const NOEXCEPT
 {
-    return queue_.size();
+    return parts_.size() - offset_;
+}
+
+// private
+const frame& message::top() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return parts_[offset_];
+    BC_POP_WARNING()
+}
+
+// private
+void message::pop() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+
+    // Release the part buffer without shifting the remaining parts.
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    parts_[offset_++] = frame{};
+    BC_POP_WARNING()
+
+    if (empty())
+        clear();
 }
 
 // Must be called on the socket thread.
-error::code message::send(socket& socket) NOEXCEPT
+error::code message::send(socket& socket, bool wait) NOEXCEPT
 {
-    while (!queue_.empty())
+    auto first = true;
+
+    while (!empty())
     {
-        frame part{ queue_.front() };
-        queue_.pop();
-        const auto ec = part.send(socket, queue_.empty());
+        // The part is retained on failure, zeromq empties it on success.
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        auto& part = parts_[offset_];
+        BC_POP_WARNING()
+
+        // Only the first part may be deferred, accepted parts are queued.
+        const auto ec = part.send(socket, is_one(size()), wait || !first);
 
         if (ec)
             return ec;
+
+        // zeromq has emptied the part, so it need not be released here.
+        ++offset_;
+        first = false;
     }
 
+    // Part storage is retained for reuse.
+    clear();
     return error::success;
 }
 
 // Must be called on the socket thread.
-error::code message::receive(socket& socket) NOEXCEPT
+error::code message::receive(socket& socket, bool wait) NOEXCEPT
 {
     clear();
     auto done = false;
 
     while (!done)
     {
-        frame frame{};
-        const auto ec = frame.receive(socket);
+        // Only the first part may be unavailable, the message is atomic.
+        const auto first = parts_.empty();
+
+        // The part is received in place and retained without copy.
+        auto& part = parts_.emplace_back();
+        const auto ec = part.receive(socket, wait || !first);
 
         if (ec)
+        {
+            parts_.pop_back();
             return ec;
+        }
 
-        queue_.push(frame.payload());
-        done = !frame.more();
+        done = !part.more();
     }
 
     return error::success;
 }
 
+message::cursor::cursor(const message& packet) NOEXCEPT
+  : packet_(&packet), position_(zero)
+{
+}
+
+bool message::cursor::read(data_slice& value) NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    value = next();
+    return true;
+}
+
+bool message::cursor::read(data_chunk& value) NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    const auto data = next();
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    value.assign(data.begin(), data.end());
+    BC_POP_WARNING()
+    return true;
+}
+
+bool message::cursor::read(std::string& value) NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    const auto data = next();
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    value.assign(data.begin(), data.end());
+    BC_POP_WARNING()
+    return true;
+}
+
+bool message::cursor::read(hash_digest& value) NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    const auto data = next();
+
+    if (data.size() != hash_size)
+        return false;
+
+    std::copy(data.begin(), data.end(), value.begin());
+    return true;
+}
+
+bool message::cursor::read(address& value) NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    const auto data = next();
+
+    if (data.size() != address_size)
+        return false;
+
+    std::copy(data.begin(), data.end(), value.begin());
+    return true;
+}
+
+data_slice message::cursor::peek() const NOEXCEPT
+{
+    return packet_->part(position_);
+}
+
+bool message::cursor::skip() NOEXCEPT
+{
+    if (empty())
+        return false;
+
+    ++position_;
+    return true;
+}
+
+bool message::cursor::empty() const NOEXCEPT
+{
+    return is_zero(remaining());
+}
+
+size_t message::cursor::position() const NOEXCEPT
+{
+    return position_;
+}
+
+size_t message::cursor::remaining() const NOEXCEPT
+{
+    const auto size = packet_->size();
+    return position_ < size ? size - position_ : zero;
+}
+
+// private
+data_slice message::cursor::next() NOEXCEPT
+{
+    return packet_->part(position_++);
+}
+
 } // namespace zmq
 } // namespace protocol
 } // namespace libbitcoin
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/payload.hpp>
+
+#include <memory>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+payload::payload() NOEXCEPT
+  : data_{}
+{
+}
+
+payload::payload(const data_slice& data) NOEXCEPT
+  : payload(to_chunk(data))
+{
+}
+
+payload::payload(data_chunk&& data) NOEXCEPT
+  : data_(to_shared(std::move(data)))
+{
+}
+
+payload::payload(const chunk_ptr& data) NOEXCEPT
+  : data_(data)
+{
+}
+
+bool payload::empty() const NOEXCEPT
+{
+    return !data_ || data_->empty();
+}
+
+size_t payload::size() const NOEXCEPT
+{
+    return data_ ? data_->size() : zero;
+}
+
+data_slice payload::data() const NOEXCEPT
+{
+    if (!data_)
+        return {};
+
+    return *data_;
+}
+
+// zeromq holds a buffer reference until the frame is sent or destroyed.
+frame payload::to_frame() const NOEXCEPT
+{
+    return { data_ };
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
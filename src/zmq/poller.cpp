@@ -18,8 +18,10 @@
  */
 #include <bitcoin/protocol/zmq/poller.hpp>
 
+#include <algorithm>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
@@ -29,26 +31,103 @@ namespace zmq {
 
 using namespace bc::system;
 
+#if defined(ZMQ_HAVE_POLLER)
+static_assert(sizeof(zmq_poller_event) == sizeof(zmq_poller_event_t));
+#endif
+
 poller::poller() NOEXCEPT
   : expired_(false),
-    terminated_(false)
+    terminated_(false),
+#if defined(ZMQ_HAVE_POLLER)
+    self_(zmq_poller_new()),
+#else
+    self_(nullptr),
+#endif
+    size_(zero)
+{
+}
+
+poller::~poller() NOEXCEPT
+{
+#if defined(ZMQ_HAVE_POLLER)
+    if (self_ != nullptr)
+        zmq_poller_destroy(&self_);
+#endif
+}
+
+bool poller::add(socket& sock) NOEXCEPT
+{
+    size_t index{};
+    return add(sock, index);
+}
+
+bool poller::add(socket& sock, size_t& index, short events) NOEXCEPT
+{
+    return sock && add(sock.self(), {}, index, events);
+}
+
+bool poller::add(file_descriptor descriptor) NOEXCEPT
+{
+    size_t index{};
+    return add(descriptor, index);
+}
+
+bool poller::add(file_descriptor descriptor, size_t& index,
+    short events) NOEXCEPT
+{
+    return add(nullptr, descriptor, index, events);
+}
+
+bool poller::modify(socket& sock, short events) NOEXCEPT
+{
+    return sock && modify(sock.self(), {}, events);
+}
+
+bool poller::modify(file_descriptor descriptor, short events) NOEXCEPT
+{
+    return modify(nullptr, descriptor, events);
+}
+
+bool poller::remove(socket& sock) NOEXCEPT
+{
+    return sock && remove(sock.self(), {});
+}
+
+bool poller::remove(file_descriptor descriptor) NOEXCEPT
+{
+    return remove(nullptr, descriptor);
+}
+
+bool poller::find(socket& sock, size_t& index) const NOEXCEPT
 {
+    return sock && find(sock.self(), {}, index);
 }
 
-// Parameter fd is non-zmq socket (unused when socket is set).
-void poller::add(socket& socket) NOEXCEPT
+bool poller::find(file_descriptor descriptor, size_t& index) const NOEXCEPT
 {
-    zmq_pollitem item;
-    item.socket = socket.self();
-    item.fd = 0;
-    item.events = ZMQ_POLLIN;
-    item.revents = 0;
-    pollers_.push_back(item);
+    return find(nullptr, descriptor, index);
 }
 
 void poller::clear() NOEXCEPT
 {
-    return pollers_.clear();
+#if defined(ZMQ_HAVE_POLLER)
+    // zmq_poller has no clear, so it is replaced.
+    if (self_ != nullptr)
+        zmq_poller_destroy(&self_);
+
+    self_ = zmq_poller_new();
+#endif
+
+    registrations_.clear();
+    unused_.clear();
+    pollers_.clear();
+    polled_.clear();
+    size_ = zero;
+}
+
+size_t poller::size() const NOEXCEPT
+{
+    return size_;
 }
 
 identifiers poller::wait() NOEXCEPT
@@ -60,8 +139,227 @@ identifiers poller::wait() NOEXCEPT
 // The timeout is typed as 'long' by zeromq. This is 32 bit on windows and
 // actually less (potentially 1000 or 1 second) on other platforms.
 // On non-windows platforms negative doesn't actually produce infinity.
+// The required zeromq (4.3.5) waits indefinitely for a negative timeout.
 identifiers poller::wait(int32_t timeout_milliseconds) NOEXCEPT
 {
+    identifiers result;
+    if (!wait(ready_, timeout_milliseconds))
+        return result;
+
+    for (const auto index: ready_)
+    {
+        if (!ready_.readable(index))
+            continue;
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        const auto& item = registrations_[index];
+        BC_POP_WARNING()
+
+        if (item.socket != nullptr)
+            result.push(item.socket);
+        else
+            result.push(item.fd);
+    }
+
+    return result;
+}
+
+bool poller::wait(readiness& ready) NOEXCEPT
+{
+    return wait(ready, zmq_maximum_safe_wait_milliseconds);
+}
+
+bool poller::wait(readiness& ready, int32_t timeout_milliseconds) NOEXCEPT
+{
+    expired_ = false;
+    ready.reset(registrations_.size());
+    return poll(ready, timeout_milliseconds);
+}
+
+bool poller::expired() const NOEXCEPT
+{
+    return expired_;
+}
+
+bool poller::terminated() const NOEXCEPT
+{
+    return terminated_;
+}
+
+// private
+// A socket is registered by its zeromq socket, otherwise by descriptor.
+// The registration index is carried by zmq_poller as user data, and by
+// zmq_poll in a table parallel to the poll items.
+bool poller::add(void* socket, file_descriptor descriptor, size_t& index,
+    short events) NOEXCEPT
+{
+    if (find(socket, descriptor, index))
+        return false;
+
+    index = unused_.empty() ? registrations_.size() : unused_.back();
+    const registration item{ socket, descriptor, true };
+
+#if defined(ZMQ_HAVE_POLLER)
+    if (self_ == nullptr)
+        return false;
+
+    const auto data = reinterpret_cast<void*>(index);
+    const auto result = socket != nullptr ?
+        zmq_poller_add(self_, socket, data, events) :
+        zmq_poller_add_fd(self_, descriptor, data, events);
+
+    if (result == zmq_fail)
+        return false;
+#else
+    // Parameter fd is non-zmq socket (unused when socket is set).
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    pollers_.push_back({ socket, descriptor, events, 0 });
+    polled_.push_back(index);
+    BC_POP_WARNING()
+#endif
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    if (unused_.empty())
+        registrations_.push_back(item);
+    else
+    {
+        registrations_[index] = item;
+        unused_.pop_back();
+    }
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    ++size_;
+    return true;
+}
+
+// private
+bool poller::modify(void* socket, file_descriptor descriptor,
+    short events) NOEXCEPT
+{
+    size_t index{};
+    if (!find(socket, descriptor, index))
+        return false;
+
+#if defined(ZMQ_HAVE_POLLER)
+    if (self_ == nullptr)
+        return false;
+
+    const auto result = socket != nullptr ?
+        zmq_poller_modify(self_, socket, events) :
+        zmq_poller_modify_fd(self_, descriptor, events);
+
+    if (result == zmq_fail)
+        return false;
+#else
+    const auto it = std::find(polled_.begin(), polled_.end(), index);
+    const auto position = std::distance(polled_.begin(), it);
+    std::next(pollers_.begin(), position)->events = events;
+#endif
+
+    return true;
+}
+
+// private
+bool poller::remove(void* socket, file_descriptor descriptor) NOEXCEPT
+{
+    size_t index{};
+    if (!find(socket, descriptor, index))
+        return false;
+
+#if defined(ZMQ_HAVE_POLLER)
+    if (self_ == nullptr)
+        return false;
+
+    const auto result = socket != nullptr ?
+        zmq_poller_remove(self_, socket) :
+        zmq_poller_remove_fd(self_, descriptor);
+
+    if (result == zmq_fail)
+        return false;
+#else
+    // Poll item order is not significant, so the last item is moved.
+    const auto it = std::find(polled_.begin(), polled_.end(), index);
+    const auto position = std::distance(polled_.begin(), it);
+    std::swap(*it, polled_.back());
+    std::swap(*std::next(pollers_.begin(), position), pollers_.back());
+    polled_.pop_back();
+    pollers_.pop_back();
+#endif
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    registrations_[index].used = false;
+    unused_.push_back(index);
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    --size_;
+    return true;
+}
+
+// private
+// Registration and removal are not performance critical, so this is a scan.
+bool poller::find(void* socket, file_descriptor descriptor,
+    size_t& index) const NOEXCEPT
+{
+    const auto it = std::find_if(registrations_.begin(), registrations_.end(),
+        [&](const registration& item) NOEXCEPT
+        {
+            return item.used && item.socket == socket &&
+                (socket != nullptr || item.fd == descriptor);
+        });
+
+    if (it == registrations_.end())
+        return false;
+
+    index = possible_narrow_sign_cast<size_t>(
+        std::distance(registrations_.begin(), it));
+    return true;
+}
+
+// private
+bool poller::poll(readiness& ready, int32_t timeout_milliseconds) NOEXCEPT
+{
+#if defined(ZMQ_HAVE_POLLER)
+    if (self_ == nullptr)
+    {
+        terminated_ = true;
+        return false;
+    }
+
+    // The buffer is retained and grown to the registration count as needed.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (events_.size() < std::max(size_, one))
+        events_.resize(std::max(size_, one));
+    BC_POP_WARNING()
+
+    const auto count = possible_narrow_sign_cast<int32_t>(
+        std::min<size_t>(events_.size(), to_unsigned(max_int32)));
+
+    // Only ready items are returned, so the cost scales with ready events.
+    const auto items = pointer_cast<zmq_poller_event_t>(events_.data());
+    const auto signaled = zmq_poller_wait_all(self_, items, count,
+        timeout_milliseconds);
+
+    // zmq_poller reports expiration as EAGAIN, not as zero events.
+    if (is_negative(signaled))
+    {
+        if (zmq_errno() == EAGAIN)
+            expired_ = true;
+        else
+            terminated_ = true;
+
+        return false;
+    }
+
+    for (auto event = events_.begin(); event != std::next(events_.begin(),
+        signaled); ++event)
+        ready.set(reinterpret_cast<size_t>(event->user_data), event->events);
+
+    return !ready.empty();
+#else
     const auto size = pollers_.size();
     BC_ASSERT(size <= max_int32);
 
@@ -73,33 +371,23 @@ identifiers poller::wait(int32_t timeout_milliseconds) NOEXCEPT
     if (is_negative(signaled))
     {
         terminated_ = true;
-        return {};
+        return false;
     }
 
     // No events have been signaled and no failure, so the timer expired.
     if (is_zero(signaled))
     {
         expired_ = true;
-        return {};
+        return false;
     }
 
-    // At least one event was signaled, but the poll-in set may be empty.
-    identifiers result;
+    // At least one event was signaled, so the items are scanned.
+    auto index = polled_.begin();
     for (const auto& poller: pollers_)
-        if (!is_zero(poller.revents & ZMQ_POLLIN))
-            result.push(poller.socket);
-
-    return result;
-}
-
-bool poller::expired() const NOEXCEPT
-{
-    return expired_;
-}
+        ready.set(*index++, poller.revents);
 
-bool poller::terminated() const NOEXCEPT
-{
-    return terminated_;
+    return !ready.empty();
+#endif
 }
 
 } // namespace zmq
@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/reactor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+reactor::reactor(size_t batch, thread_priority priority,
+    const processors& affinity, const thread_schedule& schedule) NOEXCEPT
+  : worker(priority, affinity, schedule),
+    batch_(std::max(batch, one)),
+    sequence_(zero),
+    rotation_(zero)
+{
+}
+
+reactor::~reactor() NOEXCEPT
+{
+    stop();
+}
+
+bool reactor::close() NOEXCEPT
+{
+    return true;
+}
+
+// Registrations.
+//-----------------------------------------------------------------------------
+
+bool reactor::attach(socket& sock, handler&& callback, short events) NOEXCEPT
+{
+    size_t index{};
+    return poller_.add(sock, index, events) &&
+        set_handler(index, std::move(callback));
+}
+
+bool reactor::attach(file_descriptor descriptor, handler&& callback,
+    short events) NOEXCEPT
+{
+    size_t index{};
+    return poller_.add(descriptor, index, events) &&
+        set_handler(index, std::move(callback));
+}
+
+bool reactor::modify(socket& sock, short events) NOEXCEPT
+{
+    return poller_.modify(sock, events);
+}
+
+bool reactor::modify(file_descriptor descriptor, short events) NOEXCEPT
+{
+    return poller_.modify(descriptor, events);
+}
+
+bool reactor::detach(socket& sock) NOEXCEPT
+{
+    size_t index{};
+    if (!poller_.find(sock, index) || !poller_.remove(sock))
+        return false;
+
+    clear_handler(index);
+    return true;
+}
+
+bool reactor::detach(file_descriptor descriptor) NOEXCEPT
+{
+    size_t index{};
+    if (!poller_.find(descriptor, index) || !poller_.remove(descriptor))
+        return false;
+
+    clear_handler(index);
+    return true;
+}
+
+// private
+// Registrations are indexed by poller registration index.
+bool reactor::set_handler(size_t index, handler&& callback) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (index >= registrations_.size())
+        registrations_.resize(add1(index));
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    registrations_[index] =
+    {
+        std::make_shared<handler>(std::move(callback)),
+        ++sequence_
+    };
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    return true;
+}
+
+// private
+// A handler that is executing is retained by its invocation.
+void reactor::clear_handler(size_t index) NOEXCEPT
+{
+    if (index >= registrations_.size())
+        return;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    registrations_[index] = {};
+    BC_POP_WARNING()
+}
+
+// Timers.
+//-----------------------------------------------------------------------------
+
+size_t reactor::after(duration delay, timer_handler&& callback) NOEXCEPT
+{
+    return schedule(delay, duration::zero(), std::move(callback));
+}
+
+size_t reactor::every(duration period, timer_handler&& callback) NOEXCEPT
+{
+    period = std::max(period, duration{ 1 });
+    return schedule(period, period, std::move(callback));
+}
+
+// Heap entries of a cancelled timer are discarded when they reach the front.
+bool reactor::cancel(size_t identifier) NOEXCEPT
+{
+    if (identifier >= timers_.size())
+        return false;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    if (!timers_[identifier].callback)
+        return false;
+    BC_POP_WARNING()
+
+    release(identifier);
+    return true;
+}
+
+// private
+size_t reactor::schedule(duration delay, duration period,
+    timer_handler&& callback) NOEXCEPT
+{
+    const auto identifier = unused_.empty() ? timers_.size() : unused_.back();
+    const auto sequence = ++sequence_;
+    const auto time = clock::now() + std::max(delay, duration::zero());
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    timer item
+    {
+        std::make_shared<timer_handler>(std::move(callback)),
+        period,
+        sequence
+    };
+
+    if (unused_.empty())
+        timers_.push_back(std::move(item));
+    else
+    {
+        timers_[identifier] = std::move(item);
+        unused_.pop_back();
+    }
+
+    deadlines_.push_back({ time, identifier, sequence });
+    std::push_heap(deadlines_.begin(), deadlines_.end(), later);
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    return identifier;
+}
+
+// private
+// A timer handler that is executing is retained by its invocation.
+void reactor::release(size_t identifier) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    timers_[identifier] = {};
+    unused_.push_back(identifier);
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+}
+
+// Loop.
+//-----------------------------------------------------------------------------
+
+// The stop signal is registered first, so no registration is ever missed.
+void reactor::work() NOEXCEPT
+{
+    reset();
+
+    if (!started(watch(poller_) && open()))
+    {
+        reset();
+        return;
+    }
+
+    while (!poller_.terminated() && !stopped())
+    {
+        expire();
+
+        if (poller_.wait(ready_, timeout()))
+            dispatch();
+    }
+
+    const auto result = close();
+    reset();
+    finished(result);
+}
+
+// private
+// Stale (cancelled) deadlines are discarded so they do not shorten the wait.
+int32_t reactor::timeout() NOEXCEPT
+{
+    while (!deadlines_.empty())
+    {
+        const auto& next = deadlines_.front();
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        const auto& item = timers_[next.index];
+        BC_POP_WARNING()
+
+        if (item.callback && item.sequence == next.sequence)
+        {
+            // Rounded up, so that the wait does not end before the deadline.
+            const auto remaining = std::chrono::ceil<duration>(next.time -
+                clock::now()).count();
+
+            return possible_narrow_sign_cast<int32_t>(std::clamp<int64_t>(
+                remaining, 0, max_int32));
+        }
+
+        std::pop_heap(deadlines_.begin(), deadlines_.end(), later);
+        deadlines_.pop_back();
+    }
+
+    return poller::forever;
+}
+
+// private
+// Deadlines due now are processed, bounded by the number due on entry, so
+// that a handler that schedules an immediate timer cannot starve the poll.
+void reactor::expire() NOEXCEPT
+{
+    const auto now = clock::now();
+    auto count = deadlines_.size();
+
+    while (!deadlines_.empty() && !is_zero(count--) && !stopped())
+    {
+        const auto next = deadlines_.front();
+        if (next.time > now)
+            return;
+
+        std::pop_heap(deadlines_.begin(), deadlines_.end(), later);
+        deadlines_.pop_back();
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        auto& item = timers_[next.index];
+        BC_POP_WARNING()
+
+        if (!item.callback || item.sequence != next.sequence)
+            continue;
+
+        // Retain the handler, as the timer may be released or reused.
+        const auto callback = item.callback;
+
+        if (is_zero(item.period.count()))
+        {
+            release(next.index);
+        }
+        else
+        {
+            // Periods missed (e.g. by a slow handler) are skipped.
+            auto time = next.time + item.period;
+            if (time <= now)
+                time = now + item.period;
+
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            deadlines_.push_back({ time, next.index, next.sequence });
+            std::push_heap(deadlines_.begin(), deadlines_.end(),
+                later);
+            BC_POP_WARNING()
+        }
+
+        (*callback)();
+    }
+}
+
+// private
+// Ready handlers are called round robin, each up to the batch limit while
+// it reports pending work. The first handler is rotated on each wait.
+void reactor::dispatch() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    pending_.clear();
+    for (const auto index: ready_)
+        if (index < registrations_.size() && registrations_[index].callback)
+            pending_.push_back({ index, registrations_[index].sequence });
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    if (pending_.empty())
+        return;
+
+    const auto first = rotation_++ % pending_.size();
+    std::rotate(pending_.begin(), std::next(pending_.begin(), first),
+        pending_.end());
+
+    for (auto round = zero; round < batch_ && !pending_.empty() &&
+        !stopped(); ++round)
+    {
+        // Handlers that report no further work are dropped from the round.
+        auto end = pending_.begin();
+        for (const auto& item: pending_)
+            if (invoke(item))
+                *end++ = item;
+
+        pending_.erase(end, pending_.end());
+    }
+}
+
+// private
+// A handler is not called once its registration is detached (or replaced).
+bool reactor::invoke(const pending& item) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    const auto& entry = registrations_[item.index];
+    BC_POP_WARNING()
+
+    if (!entry.callback || entry.sequence != item.sequence)
+        return false;
+
+    // Retain the handler, as the registration may be detached or reused.
+    const auto callback = entry.callback;
+    return (*callback)(ready_.events(item.index));
+}
+
+// private
+// The earliest deadline is at the front of the heap.
+bool reactor::later(const deadline& left, const deadline& right) NOEXCEPT
+{
+    return left.time > right.time;
+}
+
+// private
+void reactor::reset() NOEXCEPT
+{
+    poller_.clear();
+    registrations_.clear();
+    pending_.clear();
+    timers_.clear();
+    unused_.clear();
+    deadlines_.clear();
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/readiness.hpp>
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+readiness::readiness() NOEXCEPT
+  : events_{}, ready_{}
+{
+}
+
+bool readiness::empty() const NOEXCEPT
+{
+    return ready_.empty();
+}
+
+size_t readiness::size() const NOEXCEPT
+{
+    return ready_.size();
+}
+
+readiness::const_iterator readiness::begin() const NOEXCEPT
+{
+    return ready_.begin();
+}
+
+readiness::const_iterator readiness::end() const NOEXCEPT
+{
+    return ready_.end();
+}
+
+bool readiness::ready(size_t index) const NOEXCEPT
+{
+    return is_nonzero(events(index));
+}
+
+bool readiness::readable(size_t index) const NOEXCEPT
+{
+    return is_nonzero(events(index) & ZMQ_POLLIN);
+}
+
+bool readiness::writable(size_t index) const NOEXCEPT
+{
+    return is_nonzero(events(index) & ZMQ_POLLOUT);
+}
+
+bool readiness::failed(size_t index) const NOEXCEPT
+{
+    return is_nonzero(events(index) & ZMQ_POLLERR);
+}
+
+short readiness::events(size_t index) const NOEXCEPT
+{
+    if (index >= events_.size())
+        return 0;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return events_[index];
+    BC_POP_WARNING()
+}
+
+// Only previously ready registrations are cleared, and the event table only
+// allocates when the registration count exceeds its prior maximum.
+void readiness::reset(size_t registrations) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    for (const auto index: ready_)
+        if (index < events_.size())
+            events_[index] = 0;
+    BC_POP_WARNING()
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (events_.size() < registrations)
+        events_.resize(registrations, 0);
+    BC_POP_WARNING()
+
+    ready_.clear();
+}
+
+void readiness::set(size_t index, short events) NOEXCEPT
+{
+    if (index >= events_.size() || is_zero(events))
+        return;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    auto& value = events_[index];
+    BC_POP_WARNING()
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (is_zero(value))
+        ready_.push_back(index);
+    BC_POP_WARNING()
+
+    value |= events;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
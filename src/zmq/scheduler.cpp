@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/scheduler.hpp>
+
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/task.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Operation.
+//-----------------------------------------------------------------------------
+
+scheduler::operation::operation(scheduler& owner, socket& socket,
+    message& packet, short events) NOEXCEPT
+  : owner_(owner),
+    socket_(socket),
+    packet_(packet),
+    events_(events),
+    ec_(error::success),
+    handle_(),
+    next_(nullptr)
+{
+}
+
+bool scheduler::operation::await_ready() NOEXCEPT
+{
+    return attempt();
+}
+
+bool scheduler::operation::await_suspend(task::handle handle) NOEXCEPT
+{
+    handle_ = handle;
+    if (owner_.suspend(*this))
+        return true;
+
+    ec_ = error::socket_state;
+    return false;
+}
+
+error::code scheduler::operation::await_resume() const NOEXCEPT
+{
+    return ec_;
+}
+
+// private
+// An operation that would block has not changed the message, as only the
+// first part is sent or received without waiting (see message::send). The
+// remaining parts of an accepted or available message may briefly block.
+bool scheduler::operation::attempt() NOEXCEPT
+{
+    ec_ = is_nonzero(events_ & ZMQ_POLLIN) ? socket_.receive(packet_, false) :
+        socket_.send(packet_, false);
+
+    return ec_ != error::try_again;
+}
+
+// Scheduler.
+//-----------------------------------------------------------------------------
+
+scheduler::scheduler() NOEXCEPT
+{
+}
+
+// Suspended operations are referenced only by the task frames destroyed here.
+scheduler::~scheduler() NOEXCEPT
+{
+    poller_.clear();
+    waiters_.clear();
+
+    for (const auto handle: tasks_)
+        handle.destroy();
+}
+
+void scheduler::spawn(task&& coroutine) NOEXCEPT
+{
+    const auto handle = coroutine.release();
+    if (!handle)
+        return;
+
+    handle.promise().position = tasks_.size();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    tasks_.push_back(handle);
+    BC_POP_WARNING()
+
+    resume(handle);
+}
+
+scheduler::operation scheduler::receive(socket& socket,
+    message& packet) NOEXCEPT
+{
+    return { *this, socket, packet, ZMQ_POLLIN };
+}
+
+scheduler::operation scheduler::send(socket& socket, message& packet) NOEXCEPT
+{
+    return { *this, socket, packet, ZMQ_POLLOUT };
+}
+
+bool scheduler::run_one(int32_t timeout_milliseconds) NOEXCEPT
+{
+    if (!poller_.wait(ready_, timeout_milliseconds))
+        return !poller_.terminated();
+
+    // Completed tasks are resumed after all ready sockets are processed, as
+    // a resumed task may suspend again (changing the waiters).
+    resumable_.clear();
+    for (const auto index: ready_)
+        complete(index);
+
+    for (const auto handle: resumable_)
+        resume(handle);
+
+    return true;
+}
+
+// Tasks suspended other than by an operation of this scheduler (nothing is
+// polled) cannot be resumed here, so run fails rather than wait forever.
+bool scheduler::run() NOEXCEPT
+{
+    while (!tasks_.empty())
+        if (is_zero(poller_.size()) || !run_one())
+            return false;
+
+    return true;
+}
+
+size_t scheduler::size() const NOEXCEPT
+{
+    return tasks_.size();
+}
+
+// private
+// A socket is polled only while an operation awaits it, as the socket may be
+// closed once no task is using it.
+bool scheduler::suspend(operation& waiter) NOEXCEPT
+{
+    auto& socket = waiter.socket_;
+    size_t index{};
+
+    if (!poller_.find(socket, index))
+    {
+        if (!poller_.add(socket, index, waiter.events_))
+            return false;
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        if (index >= waiters_.size())
+            waiters_.resize(add1(index));
+        BC_POP_WARNING()
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        waiters_[index] = { &waiter, &waiter, &socket, waiter.events_ };
+        BC_POP_WARNING()
+        return true;
+    }
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    auto& queue = waiters_[index];
+    BC_POP_WARNING()
+
+    const auto events = static_cast<short>(queue.events | waiter.events_);
+    if (events != queue.events && !poller_.modify(socket, events))
+        return false;
+
+    queue.events = events;
+    queue.tail->next_ = &waiter;
+    queue.tail = &waiter;
+    return true;
+}
+
+// private
+// Waiters are attempted in order, those that would still block remain.
+void scheduler::complete(size_t index) NOEXCEPT
+{
+    if (index >= waiters_.size())
+        return;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    auto& queue = waiters_[index];
+    BC_POP_WARNING()
+
+    operation* head{ nullptr };
+    operation* tail{ nullptr };
+    short events{};
+
+    for (auto waiter = queue.head; waiter != nullptr;)
+    {
+        const auto next = std::exchange(waiter->next_, nullptr);
+
+        if (waiter->attempt())
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            resumable_.push_back(waiter->handle_);
+            BC_POP_WARNING()
+        }
+        else
+        {
+            (tail == nullptr ? head : tail->next_) = waiter;
+            tail = waiter;
+            events = static_cast<short>(events | waiter->events_);
+        }
+
+        waiter = next;
+    }
+
+    auto& socket = *queue.owner;
+    if (head == nullptr)
+    {
+        poller_.remove(socket);
+        queue = {};
+        return;
+    }
+
+    if (events != queue.events)
+        poller_.modify(socket, events);
+
+    queue = { head, tail, &socket, events };
+}
+
+// private
+// A completed task is destroyed, and the last task takes its position.
+void scheduler::resume(task::handle handle) NOEXCEPT
+{
+    handle.resume();
+    if (!handle.done())
+        return;
+
+    const auto position = handle.promise().position;
+    handle.destroy();
+
+    const auto last = tasks_.back();
+    tasks_.pop_back();
+
+    if (position == tasks_.size())
+        return;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    tasks_[position] = last;
+    BC_POP_WARNING()
+    last.promise().position = position;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -152,6 +152,13 @@ socket::socket(context& context, role socket_role,
         return;
     }
 
+    // Selects the context I/O threads that service the socket's connections.
+    if (!set_io_thread_affinity(settings.io_thread_affinity))
+    {
+        stop();
+        return;
+    }
+
     // Limited to subscriber sockets (not configured, always set by default).
     if (socket_role == role::subscriber && !set(ZMQ_SUBSCRIBE, zmq_subscribe_all))
     {
@@ -279,6 +286,23 @@ bool socket::set_certificate(const certificate& certificate) NOEXCEPT
     BC_POP_WARNING()
 }
 
+bool socket::set_io_thread_affinity(uint64_t mask) NOEXCEPT
+{
+    return set64(ZMQ_AFFINITY, sign_cast<int64_t>(mask));
+}
+
+uint64_t socket::io_thread_affinity() const NOEXCEPT
+{
+    uint64_t mask{};
+    auto size = sizeof(mask);
+
+    if (self_ == nullptr ||
+        zmq_getsockopt(self_, ZMQ_AFFINITY, &mask, &size) == zmq_fail)
+        return 0;
+
+    return mask;
+}
+
 bool socket::set_socks_proxy(const config::authority& socks_proxy) NOEXCEPT
 {
     return is_nonzero(socks_proxy.port()) &&
@@ -295,14 +319,60 @@ bool socket::set_unsubscription(const data_chunk& filter) NOEXCEPT
     return set(ZMQ_UNSUBSCRIBE, filter);
 }
 
-error::code socket::send(message& packet) NOEXCEPT
+error::code socket::send(message& packet, bool wait) NOEXCEPT
+{
+    return packet.send(*this, wait);
+}
+
+// This avoids per message call overhead when sending many messages.
+error::code socket::send_batch(std::span<message> batch, size_t& count,
+    bool wait) NOEXCEPT
+{
+    count = zero;
+
+    for (auto& packet: batch)
+    {
+        const auto ec = packet.send(*this, wait);
+
+        if (ec)
+            return ec;
+
+        ++count;
+    }
+
+    return error::success;
+}
+
+error::code socket::receive(message& packet, bool wait) NOEXCEPT
 {
-    return packet.send(*this);
+    return packet.receive(*this, wait);
 }
 
-error::code socket::receive(message& packet) NOEXCEPT
+// This amortizes a poll over all messages available on the socket.
+error::code socket::receive_batch(messages& batch, size_t& count,
+    size_t maximum) NOEXCEPT
 {
-    return packet.receive(*this);
+    count = zero;
+
+    while (count < maximum)
+    {
+        if (count == batch.size())
+            batch.emplace_back();
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        const auto ec = batch[count].receive(*this, false);
+        BC_POP_WARNING()
+
+        if (ec == error::try_again)
+            break;
+
+        if (ec)
+            return ec;
+
+        ++count;
+    }
+
+    return is_zero(count) ? error::try_again : error::success;
 }
 
 } // namespace zmq
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/wakeup.hpp>
+
+#include <array>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+#if defined(HAVE_MSC)
+    #include <winsock2.h>
+#elif defined(__linux__)
+    #include <cerrno>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+#if defined(HAVE_MSC)
+static constexpr file_descriptor invalid_descriptor = INVALID_SOCKET;
+#else
+static constexpr file_descriptor invalid_descriptor = -1;
+#endif
+
+// The descriptor is created non-blocking, so that notify never blocks when
+// signals are pending and clear never blocks when none are.
+wakeup::wakeup() NOEXCEPT
+  : read_(invalid_descriptor), write_(invalid_descriptor)
+#if defined(HAVE_MSC)
+    , initialized_(false)
+#endif
+{
+#if defined(HAVE_MSC)
+    // Balanced by WSACleanup, zeromq may not yet have initialized winsock.
+    WSADATA data{};
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+        return;
+
+    initialized_ = true;
+
+    // A loopback datagram socket connected to itself.
+    const auto self = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (self == INVALID_SOCKET)
+        return;
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    auto size = static_cast<int>(sizeof(address));
+    const auto name = pointer_cast<sockaddr>(&address);
+    u_long non_blocking{ 1 };
+
+    if (::bind(self, name, size) == SOCKET_ERROR ||
+        ::getsockname(self, name, &size) == SOCKET_ERROR ||
+        ::connect(self, name, size) == SOCKET_ERROR ||
+        ::ioctlsocket(self, FIONBIO, &non_blocking) == SOCKET_ERROR)
+    {
+        ::closesocket(self);
+        return;
+    }
+
+    read_ = write_ = self;
+
+#elif defined(__linux__)
+    // man7.org/linux/man-pages/man2/eventfd.2.html
+    const auto self = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (self == invalid_descriptor)
+        return;
+
+    read_ = write_ = self;
+
+#else
+    std::array<int, 2> pipe{};
+    if (::pipe(pipe.data()) == invalid_descriptor)
+        return;
+
+    for (const auto end: pipe)
+    {
+        if (::fcntl(end, F_SETFL, O_NONBLOCK) == invalid_descriptor ||
+            ::fcntl(end, F_SETFD, FD_CLOEXEC) == invalid_descriptor)
+        {
+            ::close(pipe.front());
+            ::close(pipe.back());
+            return;
+        }
+    }
+
+    read_ = pipe.front();
+    write_ = pipe.back();
+#endif
+}
+
+wakeup::~wakeup() NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    if (read_ != invalid_descriptor)
+        ::closesocket(read_);
+
+    // Only a successful WSAStartup is balanced.
+    if (initialized_)
+        WSACleanup();
+#else
+    if (read_ != invalid_descriptor)
+        ::close(read_);
+
+    if (write_ != read_ && write_ != invalid_descriptor)
+        ::close(write_);
+#endif
+}
+
+wakeup::operator bool() const NOEXCEPT
+{
+    return read_ != invalid_descriptor;
+}
+
+file_descriptor wakeup::descriptor() const NOEXCEPT
+{
+    return read_;
+}
+
+// A full buffer (would block) implies a pending signal, which is success.
+bool wakeup::notify() NOEXCEPT
+{
+    if (!*this)
+        return false;
+
+#if defined(HAVE_MSC)
+    const char signal{};
+    return ::send(write_, &signal, sizeof(signal), 0) != SOCKET_ERROR ||
+        WSAGetLastError() == WSAEWOULDBLOCK;
+#elif defined(__linux__)
+    const uint64_t signal{ 1 };
+    return ::write(write_, &signal, sizeof(signal)) != invalid_descriptor ||
+        errno == EAGAIN;
+#else
+    const uint8_t signal{};
+    return ::write(write_, &signal, sizeof(signal)) != invalid_descriptor ||
+        errno == EAGAIN;
+#endif
+}
+
+void wakeup::clear() NOEXCEPT
+{
+    if (!*this)
+        return;
+
+#if defined(HAVE_MSC)
+    std::array<char, 64> buffer{};
+    while (::recv(read_, buffer.data(), static_cast<int>(buffer.size()),
+        0) > 0);
+#elif defined(__linux__)
+    // A read resets the eventfd counter, consuming all signals.
+    uint64_t signals{};
+    [[maybe_unused]] const auto result = ::read(read_, &signals,
+        sizeof(signals));
+#else
+    std::array<uint8_t, 64> buffer{};
+    while (::read(read_, buffer.data(), buffer.size()) > 0);
+#endif
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
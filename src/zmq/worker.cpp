@@ -18,13 +18,21 @@
  */
 #include <bitcoin/protocol/zmq/worker.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <future>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/boost.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
 #include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/wakeup.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
 namespace libbitcoin {
@@ -33,10 +41,30 @@ namespace zmq {
 
 using namespace bc::system;
 
+// zmq_proxy_steerable control commands.
+static const std::string command_pause = "PAUSE";
+static const std::string command_resume = "RESUME";
+static const std::string command_terminate = "TERMINATE";
+static const std::string command_statistics = "STATISTICS";
+static constexpr size_t statistics_count = 8;
+
+// Each worker controls its relay on a unique inproc endpoint.
+static std::string control_endpoint() NOEXCEPT
+{
+    static std::atomic<size_t> instance{};
+    return "inproc://libbitcoin-protocol-relay-" + std::to_string(instance++);
+}
+
 // Derive from this abstract worker to implement concrete worker.
-worker::worker(thread_priority priority) NOEXCEPT
-  : priority_(priority),
-    stopped_(true)
+worker::worker(thread_priority priority, const processors& affinity,
+    const thread_schedule& schedule) NOEXCEPT
+  : stopped_(true),
+    priority_(priority),
+    affinity_(affinity),
+    schedule_(schedule),
+    configured_(false),
+    control_endpoint_(control_endpoint()),
+    relay_context_(nullptr)
 {
 }
 
@@ -56,8 +84,11 @@ bool worker::start() NOEXCEPT
     {
         stopped_ = false;
 
+        // Consume the signal of any preceding stop.
+        wakeup_.clear();
+
         // Create the worker thread and socket and start polling.
-        thread_ = std::make_shared<std::thread>(&worker::work, this);
+        thread_ = std::make_shared<std::thread>(&worker::run, this);
 
         // Wait on worker start.
         const auto result = started_.get_future().get();
@@ -72,7 +103,6 @@ bool worker::start() NOEXCEPT
 }
 
 // Promise is used (vs. join only) to capture stop result code.
-// BUGBUG: stop is insufficient to stop a worker that uses relay().
 bool worker::stop() NOEXCEPT
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -83,6 +113,14 @@ bool worker::stop() NOEXCEPT
     {
         stopped_ = true;
 
+        // Wake a watching poller (otherwise the next wait observes stopped).
+        wakeup_.notify();
+
+        // Terminate relay if published (otherwise relay observes stopped).
+        // Control is skipped (returns false) if no relay is published.
+        message reply;
+        control(command_terminate, reply);
+
         // Wait on worker stop.
         const auto result = finished_.get_future().get();
 
@@ -98,6 +136,16 @@ bool worker::stop() NOEXCEPT
     ///////////////////////////////////////////////////////////////////////////
 }
 
+// private
+// The thread is pinned before work allocates, so that memory is first touched
+// (and so placed) on the NUMA node of the pinned processors. A failure is
+// reported by started, so that a worker never runs other than as specified.
+void worker::run() NOEXCEPT
+{
+    configured_ = set_affinity(affinity_) && set_schedule(schedule_);
+    work();
+}
+
 // Utilities.
 //-----------------------------------------------------------------------------
 
@@ -108,14 +156,17 @@ bool worker::stopped() NOEXCEPT
 }
 
 // Call from work when started (connected/bound) or failed to do so.
+// A real-time schedule supersedes priority (on Windows both set the thread
+// priority), so priority is set only for a normal schedule.
 bool worker::started(bool result) NOEXCEPT
 {
+    result = result && configured_;
     started_.set_value(result);
 
-    if (result)
-        set_priority(priority_);
-    else
+    if (!result)
         finished(true);
+    else if (schedule_.policy == thread_policy::normal)
+        set_priority(priority_);
 
     return result;
 }
@@ -127,35 +178,169 @@ bool worker::finished(bool result) NOEXCEPT
     return result;
 }
 
-// TODO: use non-copying private zmq implementation of forward.
+// Call from work to register the stop signal with the work loop poller.
+bool worker::watch(poller& poller) NOEXCEPT
+{
+    return wakeup_ && poller.add(wakeup_.descriptor());
+}
+
 // Call from work to forward a message from one socket to another.
+// Each part is received into one zeromq message and moved to the destination
+// by send, preserving ZMQ_RCVMORE, so payloads are neither copied nor buffered.
+// If a send fails the remainder of the message is received and discarded, so
+// that the next forward begins on a message boundary.
 bool worker::forward(socket& from, socket& to) NOEXCEPT
 {
-    message packet;
-    return !from.receive(packet) && !to.send(packet);
+    frame part;
+    auto sent = true;
+
+    do
+    {
+        if (part.receive(from))
+            return false;
+
+        sent = sent && !part.send(to, !part.more());
+    } while (part.more());
+
+    return sent;
+}
+
+// Relay control.
+//-----------------------------------------------------------------------------
+
+bool worker::pause() NOEXCEPT
+{
+    message reply;
+    return control(command_pause, reply);
 }
 
-// Call from work to establish a proxy between two sockets.
+bool worker::resume() NOEXCEPT
+{
+    message reply;
+    return control(command_resume, reply);
+}
+
+bool worker::statistics(relay_statistics& out) NOEXCEPT
+{
+    message reply;
+    if (!control(command_statistics, reply) ||
+        reply.size() != statistics_count)
+        return false;
+
+    // zeromq sends each counter as a native-endian uint64_t.
+    std::array<uint64_t, statistics_count> counters{};
+    message::cursor reader{ reply };
+
+    for (auto& counter: counters)
+    {
+        data_slice part{};
+        if (!reader.read(part) || part.size() != sizeof(uint64_t))
+            return false;
+
+        std::memcpy(&counter, part.data(), sizeof(uint64_t));
+    }
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    out.left = { counters[0], counters[1], counters[2], counters[3] };
+    out.right = { counters[4], counters[5], counters[6], counters[7] };
+    BC_POP_WARNING()
+    return true;
+}
+
+// private
+// A relay is controlled from any thread by a transient requester socket.
+// The relay replies to each command, so each is confirmed (or times out).
+// The relay context remains published (and so alive) while the lock is held.
+// The bound relay controller has a pipe to the requester as soon as it is
+// connected, so the send does not wait and the receive wait is bounded.
+bool worker::control(const std::string& command, message& reply) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::shared_lock lock(relay_mutex_);
+
+    if (relay_context_ == nullptr)
+        return false;
+
+    socket requester(*relay_context_, socket::role::requester);
+
+    if (!requester || requester.connect({ control_endpoint_ }))
+        return false;
+
+    message request;
+    request.enqueue(command);
+
+    if (requester.send(request, false))
+        return false;
+
+    poller poller;
+    poller.add(requester);
+    const auto wait = zmq_maximum_safe_wait_milliseconds;
+    return poller.wait(wait).contains(requester.id()) &&
+        !requester.receive(reply, false);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Call from work to establish an uncontrolled proxy between two sockets.
 void worker::relay(socket& left, socket& right) NOEXCEPT
 {
     // Blocks until the context is terminated, always returns -1.
     zmq_proxy_steerable(left.self(), right.self(), nullptr, nullptr);
+}
+
+// Call from work to establish a proxy between two sockets.
+bool worker::relay(context& context, socket& left, socket& right) NOEXCEPT
+{
+    return proxy(context, left, right, nullptr);
+}
+
+// Call from work to establish a proxy between two sockets, with capture.
+bool worker::relay(context& context, socket& left, socket& right,
+    socket& capture) NOEXCEPT
+{
+    return proxy(context, left, right, capture.self());
+}
+
+// private
+bool worker::proxy(context& context, socket& left, socket& right,
+    void* capture) NOEXCEPT
+{
+    // The control socket must be bound before the relay is controllable.
+    socket controller(context, socket::role::replier);
+
+    if (!controller || controller.bind({ control_endpoint_ }))
+        return false;
+
+    // A stop that precedes publication of the context is observed here,
+    // otherwise stop sends terminate (queued until the proxy reads it).
+    if (!publish(&context))
+        return false;
+
+    // Blocks until terminated by control or context, 0 only if by control.
+    const auto terminated = zmq_proxy_steerable(left.self(), right.self(),
+        capture, controller.self()) != zmq_fail;
 
-    // Equivalent implementation:
-    ////zmq::poller poller;
-    ////poller.add(left);
-    ////poller.add(right);
-    ////
-    ////while (!poller.terminated())
-    ////{
-    ////    const auto signaled = poller.wait();
-    ////
-    ////    if (signaled.contains(left.id()))
-    ////        forward(left, right);
-    ////
-    ////    if (signaled.contains(right.id()))
-    ////        forward(right, left);
-    ////}
+    // Waits on any control in progress, which uses the context.
+    publish(nullptr);
+    return terminated;
+}
+
+// private
+// Stopped is checked under the lock that control takes, so a stop either
+// precedes publication (and the relay does not run) or its terminate is sent
+// to the published relay.
+bool worker::publish(context* relay_context) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(relay_mutex_);
+
+    if (relay_context != nullptr && stopped())
+        return false;
+
+    relay_context_ = relay_context;
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
 }
 
 } // namespace zmq
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/worker_pool.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/readiness.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Each pool relays to its repliers on a unique inproc endpoint.
+static std::string backend_endpoint() NOEXCEPT
+{
+    static std::atomic<size_t> instance{};
+    return "inproc://libbitcoin-protocol-pool-" + std::to_string(instance++);
+}
+
+// Replier.
+//-----------------------------------------------------------------------------
+
+// A pool thread that replies to requests from the pool backend.
+class worker_pool::replier
+  : public worker
+{
+public:
+    replier(worker_pool& pool) NOEXCEPT
+      : worker(pool.priority_, pool.affinity_, pool.schedule_), pool_(pool)
+    {
+    }
+
+    ~replier() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    // Request and reply storage is retained across requests.
+    // A replier socket cannot receive until it replies, so an empty reply is
+    // sent as one empty part and a replier that fails to reply stops.
+    void work() NOEXCEPT override
+    {
+        socket replier(pool_.context_, socket::role::replier);
+        size_t replied{};
+        message request;
+        message reply;
+        readiness ready;
+        poller poller;
+
+        // The poller waits forever, so a failure to watch for stop fails.
+        if (!started(!replier.connect({ pool_.backend_ }) &&
+            poller.add(replier, replied) && watch(poller)))
+            return;
+
+        auto result = true;
+        while (!poller.terminated() && !stopped())
+        {
+            if (!poller.wait(ready, poller::forever) ||
+                !ready.readable(replied) || replier.receive(request))
+                continue;
+
+            reply.clear();
+            pool_.handle(request, reply);
+
+            if (reply.empty())
+                reply.enqueue();
+
+            if (replier.send(reply))
+            {
+                result = false;
+                break;
+            }
+        }
+
+        finished(replier.stop() && result);
+    }
+
+private:
+    worker_pool& pool_;
+};
+
+// Pool.
+//-----------------------------------------------------------------------------
+
+worker_pool::worker_pool(context& context, const config::endpoint& endpoint,
+    size_t threads, thread_priority priority,
+    const processors& affinity, const thread_schedule& schedule) NOEXCEPT
+  : worker(priority, affinity, schedule),
+    context_(context),
+    endpoint_(endpoint),
+    backend_(backend_endpoint()),
+    priority_(priority),
+    affinity_(affinity),
+    schedule_(schedule)
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    repliers_.reserve(threads);
+
+    for (size_t thread = 0; thread < threads; ++thread)
+        repliers_.push_back(std::make_shared<replier>(*this));
+    BC_POP_WARNING()
+}
+
+worker_pool::~worker_pool() NOEXCEPT
+{
+    stop();
+}
+
+size_t worker_pool::threads() const NOEXCEPT
+{
+    return repliers_.size();
+}
+
+// Restartable after stop and not started on construct.
+bool worker_pool::start() NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unique_lock lock(mutex_);
+    BC_POP_WARNING()
+
+    // The backend is bound by the relay before repliers connect.
+    auto result = worker::start();
+
+    for (const auto& replier: repliers_)
+        result = result && replier->start();
+
+    if (result)
+        return true;
+
+    // Stop any started threads (stop is idempotent).
+    for (const auto& replier: repliers_)
+        replier->stop();
+
+    worker::stop();
+    return false;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+bool worker_pool::stop() NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unique_lock lock(mutex_);
+    BC_POP_WARNING()
+
+    // Stop accepting requests before stopping repliers.
+    auto result = worker::stop();
+
+    for (const auto& replier: repliers_)
+        result = replier->stop() && result;
+
+    return result;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Relay the front router to the backend dealer until stopped.
+void worker_pool::work() NOEXCEPT
+{
+    socket router(context_, socket::role::router);
+    socket dealer(context_, socket::role::dealer);
+
+    const auto bound = router && dealer &&
+        !router.bind(endpoint_) && !dealer.bind({ backend_ });
+
+    if (!started(bound))
+        return;
+
+    relay(context_, router, dealer);
+    finished(router.stop() && dealer.stop());
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
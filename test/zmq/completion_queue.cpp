@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(completion_queue_tests)
+
+BOOST_AUTO_TEST_CASE(completion_queue__empty__default__true)
+{
+    const zmq::completion_queue<size_t> instance{};
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__push__empty__true)
+{
+    zmq::completion_queue<size_t> instance{};
+    BOOST_REQUIRE(instance.push(42));
+    BOOST_REQUIRE(!instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__push__non_empty__false)
+{
+    zmq::completion_queue<size_t> instance{};
+    BOOST_REQUIRE(instance.push(1));
+    BOOST_REQUIRE(!instance.push(2));
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__drain__pushed__push_order)
+{
+    zmq::completion_queue<size_t> instance{};
+    instance.push(1);
+    instance.push(2);
+    instance.push(3);
+
+    std::vector<size_t> drained{};
+    const auto count = instance.drain([&](size_t& value) NOEXCEPT
+    {
+        drained.push_back(value);
+    });
+
+    BOOST_REQUIRE_EQUAL(count, 3u);
+    BOOST_REQUIRE(drained == std::vector<size_t>({ 1, 2, 3 }));
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__drain__empty__zero)
+{
+    zmq::completion_queue<size_t> instance{};
+    BOOST_REQUIRE_EQUAL(instance.drain([](size_t&) NOEXCEPT {}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__push__drained__true)
+{
+    zmq::completion_queue<size_t> instance{};
+    instance.push(1);
+    instance.drain([](size_t&) NOEXCEPT {});
+    BOOST_REQUIRE(instance.push(2));
+}
+
+BOOST_AUTO_TEST_CASE(completion_queue__push__concurrent__all_drained_once)
+{
+    constexpr size_t producers = 4;
+    constexpr size_t items = 1000;
+    zmq::completion_queue<size_t> instance{};
+
+    std::vector<std::thread> threads{};
+    for (size_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&instance, producer]()
+        {
+            for (size_t item = 0; item < items; ++item)
+                instance.push(producer * items + item);
+        });
+    }
+
+    // Drain concurrently with the producers.
+    std::vector<size_t> drained{};
+    const auto collect = [&](size_t& value) NOEXCEPT
+    {
+        drained.push_back(value);
+    };
+
+    while (drained.size() < producers * items)
+        instance.drain(collect);
+
+    for (auto& thread: threads)
+        thread.join();
+
+    std::sort(drained.begin(), drained.end());
+    for (size_t index = 0; index < drained.size(); ++index)
+        BOOST_REQUIRE_EQUAL(drained[index], index);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  */
 #include "../test.hpp"
 
+using namespace bc::protocol;
 using namespace bc::protocol::zmq;
 
 // These tests don't validate calls to zmq_ctx_new or zmq_ctx_term.
@@ -60,4 +61,85 @@ BOOST_AUTO_TEST_CASE(context__self__invalid_instance__is_null)
     BOOST_REQUIRE(instance.self() == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(context__constructor__default_settings__valid_instance)
+{
+    context instance{ true, {} };
+    BOOST_REQUIRE(instance);
+}
+
+BOOST_AUTO_TEST_CASE(context__constructor__settings__valid_instance)
+{
+    context_settings settings{};
+    settings.io_threads = 4;
+    settings.maximum_sockets = 4096;
+    settings.maximum_message_size = 1024;
+    context instance{ true, settings };
+    BOOST_REQUIRE(instance);
+}
+
+BOOST_AUTO_TEST_CASE(context__constructor__zero_copy_receive_disabled__expected)
+{
+    context_settings settings{};
+    settings.zero_copy_receive = false;
+    context instance{ true, settings };
+
+#if defined(ZMQ_ZERO_COPY_RECV)
+    BOOST_REQUIRE(instance);
+#else
+    BOOST_REQUIRE(!instance);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(context__constructor__affinity__valid_instance)
+{
+    context_settings settings{};
+    settings.io_affinity = { 0 };
+    context instance{ true, settings };
+    BOOST_REQUIRE(instance);
+}
+
+// The first socket creates the (pinned) I/O threads.
+BOOST_AUTO_TEST_CASE(context__constructor__affinity__socket_created)
+{
+    context_settings settings{};
+    settings.io_affinity = { 0 };
+    context instance{ true, settings };
+    BOOST_REQUIRE(instance);
+
+    zmq::socket pinned(instance, zmq::socket::role::pair);
+    BOOST_REQUIRE(pinned);
+    BOOST_REQUIRE(pinned.stop());
+}
+
+BOOST_AUTO_TEST_CASE(context__constructor__nonexistent_affinity__invalid_instance)
+{
+    context_settings settings{};
+    settings.io_affinity = { 2000 };
+    context instance{ true, settings };
+    BOOST_REQUIRE(!instance);
+}
+
+// Windows has no scheduling policy, so the priority is not range checked.
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(context__constructor__invalid_schedule__invalid_instance)
+{
+    context_settings settings{};
+    settings.io_schedule = { thread_policy::fifo, 1000 };
+    context instance{ true, settings };
+    BOOST_REQUIRE(!instance);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(context_settings__construct__default__expected)
+{
+    const context_settings settings{};
+    const auto io_threads = std::max(cores() / 4u, size_t{ 1 });
+    BOOST_REQUIRE_EQUAL(settings.io_threads, io_threads);
+    BOOST_REQUIRE_EQUAL(settings.maximum_sockets, 1023u);
+    BOOST_REQUIRE_EQUAL(settings.maximum_message_size, 0u);
+    BOOST_REQUIRE(settings.zero_copy_receive);
+    BOOST_REQUIRE(settings.io_affinity.empty());
+    BOOST_REQUIRE(settings.io_schedule.policy == thread_policy::normal);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
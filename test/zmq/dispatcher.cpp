@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(dispatcher_tests)
+
+#define TEST_DISPATCHER_ENDPOINT TEST_INPROC_ENDPOINT "-dispatcher"
+
+class echo_dispatcher
+  : public zmq::dispatcher
+{
+public:
+    using dispatcher::dispatcher;
+
+    ~echo_dispatcher() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    void handle(zmq::message& request, zmq::message& reply) NOEXCEPT override
+    {
+        reply.enqueue(request.dequeue_text());
+    }
+};
+
+BOOST_AUTO_TEST_CASE(dispatcher__threads__default__cores)
+{
+    zmq::context context;
+    const echo_dispatcher instance{ context, { TEST_DISPATCHER_ENDPOINT } };
+    BOOST_REQUIRE_EQUAL(instance.threads(), cores());
+}
+
+BOOST_AUTO_TEST_CASE(dispatcher__start__requesters__replied)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    echo_dispatcher instance{ context, { TEST_DISPATCHER_ENDPOINT }, 2 };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket first(context, role::requester);
+    REQUIRE_SUCCESS(first.connect({ TEST_DISPATCHER_ENDPOINT }));
+    zmq::socket second(context, role::requester);
+    REQUIRE_SUCCESS(second.connect({ TEST_DISPATCHER_ENDPOINT }));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE "1");
+    REQUIRE_SUCCESS(first.send(out));
+    out.enqueue(TEST_MESSAGE "2");
+    REQUIRE_SUCCESS(second.send(out));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(second.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "2");
+    REQUIRE_SUCCESS(first.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "1");
+
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(dispatcher__start__dealer__all_replied)
+{
+    constexpr size_t requests = 100;
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    echo_dispatcher instance{ context, { TEST_DISPATCHER_ENDPOINT }, 4 };
+    BOOST_REQUIRE(instance.start());
+
+    // A dealer sends without an empty delimiter and may pipeline requests.
+    zmq::socket dealer(context, role::dealer);
+    REQUIRE_SUCCESS(dealer.connect({ TEST_DISPATCHER_ENDPOINT }));
+
+    zmq::message out;
+    for (size_t request = 0; request < requests; ++request)
+    {
+        out.enqueue(std::to_string(request));
+        REQUIRE_SUCCESS(dealer.send(out));
+    }
+
+    // Replies may complete out of order.
+    std::vector<bool> replied(requests, false);
+    zmq::message in;
+    for (size_t reply = 0; reply < requests; ++reply)
+    {
+        REQUIRE_SUCCESS(dealer.receive(in));
+        BOOST_REQUIRE_EQUAL(in.size(), 1u);
+        replied.at(std::stoul(in.dequeue_text())) = true;
+    }
+
+    BOOST_REQUIRE(std::all_of(replied.begin(), replied.end(),
+        [](bool value) { return value; }));
+
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(dispatcher__start__sustained_requests__replied)
+{
+    constexpr size_t replies = 100;
+    constexpr size_t maximum = 100'000;
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    echo_dispatcher instance{ context, { TEST_DISPATCHER_ENDPOINT }, 2 };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket dealer(context, role::dealer);
+    REQUIRE_SUCCESS(dealer.connect({ TEST_DISPATCHER_ENDPOINT }));
+
+    // Requests are kept queued ahead of the dispatcher while replying.
+    size_t sent{};
+    size_t received{};
+    zmq::message out;
+    zmq::message in;
+    while (received < replies)
+    {
+        BOOST_REQUIRE_LT(sent, maximum);
+
+        for (size_t request = 0; request < 10u; ++request, ++sent)
+        {
+            out.enqueue(TEST_MESSAGE);
+            REQUIRE_SUCCESS(dealer.send(out));
+        }
+
+        while (received < replies && !dealer.receive(in, false))
+        {
+            BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+            ++received;
+        }
+    }
+
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(dispatcher__start__endpoint_in_use__false)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket existing(context, role::router);
+    REQUIRE_SUCCESS(existing.bind({ TEST_DISPATCHER_ENDPOINT }));
+
+    echo_dispatcher instance{ context, { TEST_DISPATCHER_ENDPOINT }, 2 };
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
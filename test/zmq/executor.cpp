@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(executor_tests)
+
+BOOST_AUTO_TEST_CASE(executor__threads__default__cores)
+{
+    const zmq::executor instance{};
+    BOOST_REQUIRE_EQUAL(instance.threads(), cores());
+}
+
+BOOST_AUTO_TEST_CASE(executor__threads__zero__one)
+{
+    const zmq::executor instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.threads(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(executor__start__invalid_affinity__false)
+{
+    zmq::executor instance{ 2, thread_priority::normal,
+        { bc::system::max_size_t } };
+    BOOST_REQUIRE(!instance.start());
+    BOOST_REQUIRE(!instance.submit([]() NOEXCEPT {}));
+}
+
+// Windows has no scheduling policy, so the priority is not range checked.
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(executor__start__invalid_schedule__false)
+{
+    zmq::executor instance{ 2, thread_priority::normal, {},
+        { thread_policy::fifo, 1000 } };
+    BOOST_REQUIRE(!instance.start());
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(executor__submit__not_started__false)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(!instance.submit([]() NOEXCEPT {}));
+}
+
+BOOST_AUTO_TEST_CASE(executor__start__started__false)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(!instance.start());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(executor__stop__not_started__true)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(executor__submit__started__all_executed)
+{
+    constexpr size_t tasks = 1000;
+    zmq::executor instance{ 4 };
+    BOOST_REQUIRE(instance.start());
+
+    std::atomic<size_t> executed{};
+    for (size_t task = 0; task < tasks; ++task)
+        BOOST_REQUIRE(instance.submit([&executed]() NOEXCEPT
+        {
+            ++executed;
+        }));
+
+    while (executed < tasks)
+        std::this_thread::yield();
+
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(executed, tasks);
+}
+
+BOOST_AUTO_TEST_CASE(executor__submit__from_task__executed)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(instance.start());
+
+    std::promise<bool> promise{};
+    BOOST_REQUIRE(instance.submit([&]() NOEXCEPT
+    {
+        promise.set_value(instance.submit([&]() NOEXCEPT {}));
+    }));
+
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(executor__submit__blocked_thread__stolen)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(instance.start());
+
+    // The first task holds its thread until the tasks it queues locally have
+    // been executed, which is possible only if they are stolen.
+    std::promise<bool> promise{};
+    BOOST_REQUIRE(instance.submit([&]() NOEXCEPT
+    {
+        std::atomic<size_t> executed{};
+        for (size_t task = 0; task < 10; ++task)
+            instance.submit([&executed]() NOEXCEPT { ++executed; });
+
+        while (executed < 10u)
+            std::this_thread::yield();
+
+        promise.set_value(true);
+    }));
+
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(executor__start__restarted__executes)
+{
+    zmq::executor instance{ 2 };
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE(instance.start());
+
+    std::promise<bool> promise{};
+    BOOST_REQUIRE(instance.submit([&]() NOEXCEPT { promise.set_value(true); }));
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -84,4 +84,154 @@ BOOST_AUTO_TEST_CASE(frame__constuctor2__non_empty__expected_payload)
     BOOST_REQUIRE(instance.payload() == expected);
 }
 
+// constuctor3
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__empty__valid_empty_payload)
+{
+    const frame instance{ data_chunk{} };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(!instance.more());
+    BOOST_REQUIRE(instance.payload().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__inline__expected_payload)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    auto copy = expected;
+    const frame instance{ std::move(copy) };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__adopted__expected_payload)
+{
+    const data_chunk expected(1024, 0x42);
+    auto copy = expected;
+    const frame instance{ std::move(copy) };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(!instance.more());
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+// constuctor4
+
+BOOST_AUTO_TEST_CASE(frame__constuctor4__null__valid_empty_payload)
+{
+    const frame instance{ chunk_ptr{} };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor4__inline__expected_payload_unshared)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    const auto shared = std::make_shared<data_chunk>(expected);
+    const frame instance{ shared };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor4__shared__expected_payload_released)
+{
+    const data_chunk expected(1024, 0x42);
+    const auto shared = std::make_shared<data_chunk>(expected);
+    {
+        const frame instance{ shared };
+        BOOST_REQUIRE(instance);
+        BOOST_REQUIRE(instance.payload() == expected);
+        BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+    }
+
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 1);
+}
+
+// constuctor5
+
+BOOST_AUTO_TEST_CASE(frame__constuctor5__zero__valid_empty_payload)
+{
+    frame instance{ zero };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload().empty());
+    BOOST_REQUIRE_EQUAL(instance.buffer().size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor5__non_zero__written_payload)
+{
+    const data_chunk expected(1024, 0x42);
+    frame instance{ expected.size() };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+
+    const auto buffer = instance.buffer();
+    BOOST_REQUIRE_EQUAL(buffer.size(), expected.size());
+    std::copy(expected.begin(), expected.end(), buffer.begin());
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+// move
+
+BOOST_AUTO_TEST_CASE(frame__move__adopted__expected_payload_other_empty)
+{
+    const data_chunk expected(1024, 0x42);
+    auto copy = expected;
+    frame other{ std::move(copy) };
+    const frame instance{ std::move(other) };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+    BOOST_REQUIRE(other);
+    BOOST_REQUIRE(other.payload().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__move_assign__inline__expected_payload)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    frame other{ expected };
+    frame instance{ data_chunk(1024, 0x42) };
+    instance = std::move(other);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+// copy
+
+BOOST_AUTO_TEST_CASE(frame__copy__shared__same_buffer)
+{
+    const data_chunk expected(1024, 0x42);
+    const auto shared = std::make_shared<data_chunk>(expected);
+    const frame other{ shared };
+    const frame instance{ other };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.data().data() == other.data().data());
+    BOOST_REQUIRE(instance.payload() == expected);
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(frame__copy_assign__inline__expected_payloads)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    const frame other{ expected };
+    frame instance{};
+    instance = other;
+    BOOST_REQUIRE(instance.payload() == expected);
+    BOOST_REQUIRE(other.payload() == expected);
+}
+
+// size/data
+
+BOOST_AUTO_TEST_CASE(frame__size__default__zero)
+{
+    const frame instance;
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__data__non_empty__expected_view)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    const frame instance{ expected };
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    BOOST_REQUIRE(to_chunk(instance.data()) == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
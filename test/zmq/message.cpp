@@ -30,13 +30,36 @@ static const auto number2 = from_little_endian<uint32_t>(chunk2);
 static const auto hash1 = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
 static const auto hash2 = base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
 
+#define TEST_TEXT "the quick brown fox jumps over the lazy dog"
+
+// Serializes as chunk1, followed by a large body if witness.
+struct serializable
+{
+    size_t serialized_size(bool witness) const NOEXCEPT
+    {
+        return chunk1.size() + (witness ? body.size() : zero);
+    }
+
+    void to_data(writer& sink, bool witness) const NOEXCEPT
+    {
+        sink.write_bytes(chunk1);
+
+        if (witness)
+            sink.write_bytes(body);
+    }
+
+    const data_chunk body = data_chunk(1024, 0x42);
+};
+
 class message_fixture
   : public protocol::zmq::message
 {
 public:
-    auto& queue() NOEXCEPT
+    using message::message;
+
+    auto& parts() NOEXCEPT
     {
-        return queue_;
+        return parts_;
     };
 };
 
@@ -54,6 +77,40 @@ BOOST_AUTO_TEST_CASE(message__constructor__always__size_0)
     BOOST_REQUIRE_EQUAL(instance.size(), 0u);
 }
 
+BOOST_AUTO_TEST_CASE(message__constructor__move_partially_dequeued__source_empty)
+{
+    protocol::zmq::message other;
+    other.enqueue(chunk1);
+    other.enqueue(chunk2);
+    BOOST_REQUIRE(other.dequeue());
+
+    protocol::zmq::message instance{ std::move(other) };
+    BOOST_REQUIRE(other.empty());
+    BOOST_REQUIRE_EQUAL(other.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk2);
+}
+
+BOOST_AUTO_TEST_CASE(message__assign__move_partially_dequeued__source_empty)
+{
+    protocol::zmq::message other;
+    other.enqueue(chunk1);
+    other.enqueue(chunk2);
+    BOOST_REQUIRE(other.dequeue());
+
+    protocol::zmq::message instance;
+    instance.enqueue(chunk1);
+    instance = std::move(other);
+    BOOST_REQUIRE(other.empty());
+    BOOST_REQUIRE_EQUAL(other.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk2);
+
+    // The moved-from message is reusable.
+    other.enqueue(chunk1);
+    BOOST_REQUIRE(other.dequeue_data() == chunk1);
+}
+
 // enqueue1
 
 BOOST_AUTO_TEST_CASE(message__enqueue1__empty__size_1)
@@ -67,11 +124,11 @@ BOOST_AUTO_TEST_CASE(message__enqueue1__empty__size_1)
 BOOST_AUTO_TEST_CASE(message__enqueue1__nonempty__ordered)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     instance.enqueue();
     BOOST_REQUIRE_EQUAL(instance.size(), 2u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
-    BOOST_REQUIRE(instance.queue().back().empty());
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+    BOOST_REQUIRE(instance.parts().back().payload().empty());
 }
 
 // enqueue2
@@ -81,17 +138,17 @@ BOOST_AUTO_TEST_CASE(message__enqueue2__empty__size_1_expected)
     message_fixture instance;
     instance.enqueue(chunk1);
     BOOST_REQUIRE_EQUAL(instance.size(), 1u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
 }
 
 BOOST_AUTO_TEST_CASE(message__enqueue2__nonempty__ordered)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     instance.enqueue(chunk2);
     BOOST_REQUIRE_EQUAL(instance.size(), 2u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
-    BOOST_REQUIRE(instance.queue().back() == chunk2);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+    BOOST_REQUIRE(instance.parts().back().payload() == chunk2);
 }
 
 // enqueue3
@@ -101,17 +158,17 @@ BOOST_AUTO_TEST_CASE(message__enqueue3__empty__size_1_expected)
     message_fixture instance;
     instance.enqueue(to_chunk(chunk1));
     BOOST_REQUIRE_EQUAL(instance.size(), 1u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
 }
 
 BOOST_AUTO_TEST_CASE(message__enqueue3__nonempty__ordered)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     instance.enqueue(to_chunk(chunk2));
     BOOST_REQUIRE_EQUAL(instance.size(), 2u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
-    BOOST_REQUIRE(instance.queue().back() == chunk2);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+    BOOST_REQUIRE(instance.parts().back().payload() == chunk2);
 }
 
 // enqueue4
@@ -125,7 +182,7 @@ BOOST_AUTO_TEST_CASE(message__enqueue4__empty__size_1_expected)
     message_fixture instance;
     instance.enqueue(text2);
     BOOST_REQUIRE_EQUAL(instance.size(), 1u);
-    const auto& value = instance.queue().front();
+    const auto value = instance.parts().front().payload();
     BOOST_REQUIRE(value == chunk2);
 }
 
@@ -136,11 +193,58 @@ BOOST_AUTO_TEST_CASE(message__enqueue4__nonempty__ordered)
     BOOST_REQUIRE_EQUAL(text2.size(), 4u);
 
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     instance.enqueue(text2);
     BOOST_REQUIRE_EQUAL(instance.size(), 2u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
-    BOOST_REQUIRE(instance.queue().back() == chunk2);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+    BOOST_REQUIRE(instance.parts().back().payload() == chunk2);
+}
+
+// enqueue5
+
+BOOST_AUTO_TEST_CASE(message__enqueue5__shared_payload__not_copied)
+{
+    const auto shared = std::make_shared<data_chunk>(1024, 0x42);
+    const payload value{ shared };
+    message_fixture first;
+    message_fixture second;
+    first.enqueue(value);
+    second.enqueue(value);
+    BOOST_REQUIRE_EQUAL(first.size(), 1u);
+    BOOST_REQUIRE_EQUAL(second.size(), 1u);
+    BOOST_REQUIRE(first.front().data() == shared->data());
+    BOOST_REQUIRE(second.front().data() == shared->data());
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 4);
+
+    first.clear();
+    second.clear();
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+}
+
+// enqueue_serialized
+
+BOOST_AUTO_TEST_CASE(message__enqueue_serialized__small__expected)
+{
+    const serializable object{};
+    message_fixture instance;
+    BOOST_REQUIRE(instance.enqueue_serialized(object, false));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+}
+
+BOOST_AUTO_TEST_CASE(message__enqueue_serialized__large__expected)
+{
+    const serializable object{};
+    message_fixture instance;
+    instance.enqueue(chunk2);
+    BOOST_REQUIRE(instance.enqueue_serialized(object, true));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    const auto data = instance.parts().back().payload();
+    BOOST_REQUIRE_EQUAL(data.size(), chunk1.size() + object.body.size());
+    BOOST_REQUIRE(std::equal(chunk1.begin(), chunk1.end(), data.begin()));
+    BOOST_REQUIRE(std::equal(object.body.begin(), object.body.end(),
+        std::next(data.begin(), chunk1.size())));
 }
 
 // enqueue_little_endian
@@ -150,18 +254,18 @@ BOOST_AUTO_TEST_CASE(message__enqueue_little_endian__empty__size_1_expected)
     message_fixture instance;
     instance.enqueue_little_endian<uint32_t>(number2);
     BOOST_REQUIRE_EQUAL(instance.size(), 1u);
-    const auto& bytes = instance.queue().front();
+    const auto bytes = instance.parts().front().payload();
     BOOST_REQUIRE_EQUAL(from_little_endian<uint32_t>(bytes), number2);
 }
 
 BOOST_AUTO_TEST_CASE(message__enqueue_little_endian__nonempty__ordered)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     instance.enqueue_little_endian<uint32_t>(number2);
     BOOST_REQUIRE_EQUAL(instance.size(), 2u);
-    BOOST_REQUIRE(instance.queue().front() == chunk1);
-    BOOST_REQUIRE(instance.queue().back() == chunk2);
+    BOOST_REQUIRE(instance.parts().front().payload() == chunk1);
+    BOOST_REQUIRE(instance.parts().back().payload() == chunk2);
 }
 
 // clear
@@ -193,7 +297,7 @@ BOOST_AUTO_TEST_CASE(message__dequeue1__empty__false)
 BOOST_AUTO_TEST_CASE(message__dequeue1__nonempty__true_empty)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     BOOST_REQUIRE(instance.dequeue());
     BOOST_REQUIRE(instance.empty());
 }
@@ -210,7 +314,7 @@ BOOST_AUTO_TEST_CASE(message__dequeue2__empty__false)
 BOOST_AUTO_TEST_CASE(message__dequeue2__mismatched__false_empty)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     uint32_t out{};
     BOOST_REQUIRE(!instance.dequeue(out));
     BOOST_REQUIRE(instance.empty());
@@ -219,8 +323,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue2__mismatched__false_empty)
 BOOST_AUTO_TEST_CASE(message__dequeue2__two__true_ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk2);
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
     uint32_t out{};
     BOOST_REQUIRE(instance.dequeue(out));
     BOOST_REQUIRE_EQUAL(out, number2);
@@ -238,8 +342,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue3__empty__false)
 BOOST_AUTO_TEST_CASE(message__dequeue3__two__true_ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk2);
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
     data_chunk out;
     BOOST_REQUIRE(instance.dequeue(out));
     BOOST_REQUIRE(out == chunk2);
@@ -259,8 +363,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue4__empty__false)
 BOOST_AUTO_TEST_CASE(message__dequeue4__two__true_ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk2);
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
     std::string out;
     BOOST_REQUIRE(instance.dequeue(out));
     BOOST_REQUIRE(to_chunk(out) == chunk2);
@@ -280,7 +384,7 @@ BOOST_AUTO_TEST_CASE(message__dequeue5__empty__false)
 BOOST_AUTO_TEST_CASE(message__dequeue5__mismatched__false_empty)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk1);
     hash_digest out{};
     BOOST_REQUIRE(!instance.dequeue(out));
     BOOST_REQUIRE(instance.empty());
@@ -289,8 +393,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue5__mismatched__false_empty)
 BOOST_AUTO_TEST_CASE(message__dequeue5__two__true_ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(to_chunk(hash1));
-    instance.queue().emplace(to_chunk(hash2));
+    instance.parts().emplace_back(to_chunk(hash1));
+    instance.parts().emplace_back(to_chunk(hash2));
     hash_digest out{};
     BOOST_REQUIRE(instance.dequeue(out));
     BOOST_REQUIRE(out == hash1);
@@ -298,6 +402,226 @@ BOOST_AUTO_TEST_CASE(message__dequeue5__two__true_ordered_expected)
     BOOST_REQUIRE(out == hash2);
 }
 
+// reuse
+
+BOOST_AUTO_TEST_CASE(message__clear__nonempty__capacity_retained)
+{
+    message_fixture instance;
+    instance.enqueue(chunk1);
+    instance.enqueue(chunk2);
+    const auto capacity = instance.parts().capacity();
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.parts().capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(message__dequeue__all__capacity_retained)
+{
+    message_fixture instance;
+    instance.enqueue(chunk1);
+    instance.enqueue(chunk2);
+    const auto capacity = instance.parts().capacity();
+    BOOST_REQUIRE(instance.dequeue());
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.dequeue());
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.parts().capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(message__enqueue__after_partial_dequeue__ordered)
+{
+    protocol::zmq::message instance;
+    instance.enqueue(chunk1);
+    instance.enqueue(chunk2);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk1);
+    instance.enqueue(chunk1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk2);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk1);
+    BOOST_REQUIRE(instance.empty());
+}
+
+// front
+
+BOOST_AUTO_TEST_CASE(message__front__empty__empty)
+{
+    protocol::zmq::message instance;
+    BOOST_REQUIRE(instance.front().empty());
+}
+
+BOOST_AUTO_TEST_CASE(message__front__two__expected_not_dequeued)
+{
+    message_fixture instance;
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
+    BOOST_REQUIRE(to_chunk(instance.front()) == chunk2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+// part
+
+BOOST_AUTO_TEST_CASE(message__part__out_of_range__empty)
+{
+    message_fixture instance;
+    instance.parts().emplace_back(chunk2);
+    BOOST_REQUIRE(instance.part(1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(message__part__after_dequeue__relative_to_top)
+{
+    message_fixture instance;
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
+    instance.parts().emplace_back(chunk2);
+    BOOST_REQUIRE(instance.dequeue());
+    BOOST_REQUIRE(to_chunk(instance.part(0)) == chunk1);
+    BOOST_REQUIRE(to_chunk(instance.part(1)) == chunk2);
+    BOOST_REQUIRE(instance.part(2).empty());
+}
+
+// begin/end
+
+BOOST_AUTO_TEST_CASE(message__begin__empty__end)
+{
+    protocol::zmq::message instance;
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(message__begin__after_dequeue__remaining_parts_in_order)
+{
+    message_fixture instance;
+    instance.parts().emplace_back(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
+    BOOST_REQUIRE(instance.dequeue());
+
+    std::vector<data_chunk> parts{};
+    for (const auto& part: instance)
+        parts.push_back(part.payload());
+
+    BOOST_REQUIRE_EQUAL(parts.size(), 2u);
+    BOOST_REQUIRE(parts[0] == chunk2);
+    BOOST_REQUIRE(parts[1] == chunk1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+// cursor
+
+BOOST_AUTO_TEST_CASE(message__cursor__empty__empty_reads_false)
+{
+    const protocol::zmq::message instance;
+    protocol::zmq::message::cursor reader{ instance };
+    BOOST_REQUIRE(reader.empty());
+    BOOST_REQUIRE_EQUAL(reader.remaining(), 0u);
+    BOOST_REQUIRE(reader.peek().empty());
+    BOOST_REQUIRE(!reader.skip());
+
+    std::string text{};
+    BOOST_REQUIRE(!reader.read(text));
+}
+
+BOOST_AUTO_TEST_CASE(message__cursor__reads__expected_message_unmodified)
+{
+    protocol::zmq::message instance;
+    instance.enqueue(protocol::zmq::message::address{ 1, 2, 3, 4, 5 });
+    instance.enqueue(std::string{ TEST_TEXT });
+    instance.enqueue_little_endian<uint32_t>(number2);
+    instance.enqueue(chunk1);
+
+    protocol::zmq::message::cursor reader{ instance };
+    BOOST_REQUIRE_EQUAL(reader.remaining(), 4u);
+
+    protocol::zmq::message::address route{};
+    BOOST_REQUIRE(reader.read(route));
+    BOOST_REQUIRE(route == protocol::zmq::message::address({ 1, 2, 3, 4, 5 }));
+    BOOST_REQUIRE_EQUAL(to_string(reader.peek()), TEST_TEXT);
+
+    std::string text{};
+    BOOST_REQUIRE(reader.read(text));
+    BOOST_REQUIRE_EQUAL(text, TEST_TEXT);
+
+    uint32_t number{};
+    BOOST_REQUIRE(reader.read(number));
+    BOOST_REQUIRE_EQUAL(number, number2);
+
+    data_slice data{};
+    BOOST_REQUIRE(reader.read(data));
+    BOOST_REQUIRE(to_chunk(data) == chunk1);
+    BOOST_REQUIRE(reader.empty());
+    BOOST_REQUIRE_EQUAL(reader.position(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(message__cursor__invalid_size__false_advanced)
+{
+    protocol::zmq::message instance;
+    instance.enqueue(chunk1);
+    instance.enqueue(chunk2);
+
+    protocol::zmq::message::cursor reader{ instance };
+    hash_digest hash{};
+    BOOST_REQUIRE(!reader.read(hash));
+    BOOST_REQUIRE_EQUAL(reader.position(), 1u);
+
+    uint32_t number{};
+    BOOST_REQUIRE(reader.read(number));
+    BOOST_REQUIRE_EQUAL(number, number2);
+}
+
+// resource
+
+BOOST_AUTO_TEST_CASE(message__constructor__resource__parts_allocated_from_resource)
+{
+    std::pmr::monotonic_buffer_resource arena{};
+    message_fixture instance{ &arena };
+    instance.enqueue(chunk1);
+    BOOST_REQUIRE(instance.parts().get_allocator().resource() == &arena);
+    BOOST_REQUIRE(instance.dequeue_data() == chunk1);
+}
+
+// dequeue6
+
+BOOST_AUTO_TEST_CASE(message__dequeue6__empty__false)
+{
+    protocol::zmq::message instance;
+    protocol::zmq::message::pmr_chunk out;
+    BOOST_REQUIRE(!instance.dequeue(out));
+}
+
+BOOST_AUTO_TEST_CASE(message__dequeue6__two__true_ordered_expected_resource)
+{
+    std::pmr::monotonic_buffer_resource arena{};
+    protocol::zmq::message instance;
+    instance.enqueue(chunk2);
+    instance.enqueue(chunk1);
+    protocol::zmq::message::pmr_chunk out{ &arena };
+    BOOST_REQUIRE(instance.dequeue(out));
+    BOOST_REQUIRE(data_chunk(out.begin(), out.end()) == chunk2);
+    BOOST_REQUIRE(instance.dequeue(out));
+    BOOST_REQUIRE(data_chunk(out.begin(), out.end()) == chunk1);
+    BOOST_REQUIRE(out.get_allocator().resource() == &arena);
+}
+
+// dequeue7
+
+BOOST_AUTO_TEST_CASE(message__dequeue7__empty__false)
+{
+    protocol::zmq::message instance;
+    std::pmr::string out;
+    BOOST_REQUIRE(!instance.dequeue(out));
+}
+
+BOOST_AUTO_TEST_CASE(message__dequeue7__text__true_expected_resource)
+{
+    std::pmr::monotonic_buffer_resource arena{};
+    protocol::zmq::message instance;
+    instance.enqueue(std::string{ TEST_TEXT });
+    std::pmr::string out{ &arena };
+    BOOST_REQUIRE(instance.dequeue(out));
+    BOOST_REQUIRE_EQUAL(out, TEST_TEXT);
+    BOOST_REQUIRE(out.get_allocator().resource() == &arena);
+}
+
 // dequeue_data
 
 BOOST_AUTO_TEST_CASE(message__dequeue_data__empty__empty)
@@ -309,8 +633,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue_data__empty__empty)
 BOOST_AUTO_TEST_CASE(message__dequeue_data__two__ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk2);
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
     BOOST_REQUIRE(instance.dequeue_data() == chunk2);
     BOOST_REQUIRE(instance.dequeue_data() == chunk1);
 }
@@ -326,8 +650,8 @@ BOOST_AUTO_TEST_CASE(message__dequeue_text__from_empty__empty)
 BOOST_AUTO_TEST_CASE(message__dequeue_text__two__ordered_expected)
 {
     message_fixture instance;
-    instance.queue().emplace(chunk2);
-    instance.queue().emplace(chunk1);
+    instance.parts().emplace_back(chunk2);
+    instance.parts().emplace_back(chunk1);
     BOOST_REQUIRE(to_chunk(instance.dequeue_text()) == chunk2);
     BOOST_REQUIRE(to_chunk(instance.dequeue_text()) == chunk1);
 }
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol::zmq;
+
+BOOST_AUTO_TEST_SUITE(message_schema_tests)
+
+typedef message_schema<message::address, std::string, uint32_t, hash_digest>
+    schema;
+typedef message_schema<uint16_t, message::address> fixed_schema;
+
+static const message::address address1{ 0x01, 0x02, 0x03, 0x04, 0x05 };
+static const hash_digest hash1{ 0x42 };
+
+// constants
+
+BOOST_AUTO_TEST_CASE(message_schema__parts__always__expected)
+{
+    static_assert(schema::parts == 4u);
+    static_assert(fixed_schema::parts == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__part_size__always__expected)
+{
+    static_assert(schema::part_size<0>() == message::address_size);
+    static_assert(schema::part_size<1>() == schema::variable);
+    static_assert(schema::part_size<2>() == sizeof(uint32_t));
+    static_assert(schema::part_size<3>() == hash_size);
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__is_fixed__always__expected)
+{
+    static_assert(!schema::is_fixed());
+    static_assert(fixed_schema::is_fixed());
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__fixed_size__always__expected)
+{
+    static_assert(schema::fixed_size() == 5u + 4u + 32u);
+    static_assert(fixed_schema::fixed_size() == 2u + 5u);
+}
+
+// enqueue/decode
+
+BOOST_AUTO_TEST_CASE(message_schema__enqueue__values__expected_parts)
+{
+    message packet;
+    schema::enqueue(packet, { address1, "hello", 42u, hash1 });
+    BOOST_REQUIRE_EQUAL(packet.size(), 4u);
+    BOOST_REQUIRE(to_chunk(packet.part(0)) == to_chunk(address1));
+    BOOST_REQUIRE_EQUAL(to_string(packet.part(1)), "hello");
+    BOOST_REQUIRE_EQUAL(from_little_endian<uint32_t>(packet.part(2)), 42u);
+    BOOST_REQUIRE(to_chunk(packet.part(3)) == to_chunk(hash1));
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__decode__valid__expected_values_unmodified_message)
+{
+    message packet;
+    schema::enqueue(packet, { address1, "hello", 42u, hash1 });
+    BOOST_REQUIRE(schema::is_valid(packet));
+
+    schema::values values{};
+    BOOST_REQUIRE(schema::decode(values, packet));
+    BOOST_REQUIRE(std::get<0>(values) == address1);
+    BOOST_REQUIRE_EQUAL(std::get<1>(values), "hello");
+    BOOST_REQUIRE_EQUAL(std::get<2>(values), 42u);
+    BOOST_REQUIRE(std::get<3>(values) == hash1);
+    BOOST_REQUIRE_EQUAL(packet.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__decode__missing_part__false_values_unchanged)
+{
+    message packet;
+    packet.enqueue(address1);
+    packet.enqueue(std::string{ "hello" });
+    packet.enqueue_little_endian<uint32_t>(42);
+    BOOST_REQUIRE(!schema::is_valid(packet));
+
+    schema::values values{};
+    BOOST_REQUIRE(!schema::decode(values, packet));
+    BOOST_REQUIRE(std::get<1>(values).empty());
+    BOOST_REQUIRE_EQUAL(std::get<2>(values), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__decode__invalid_part_size__false_values_unchanged)
+{
+    message packet;
+    packet.enqueue(address1);
+    packet.enqueue(std::string{ "hello" });
+    packet.enqueue_little_endian<uint16_t>(42);
+    packet.enqueue(hash1);
+    BOOST_REQUIRE(!schema::is_valid(packet));
+
+    schema::values values{};
+    BOOST_REQUIRE(!schema::decode(values, packet));
+    BOOST_REQUIRE(std::get<1>(values).empty());
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__decode__extra_part__false)
+{
+    message packet;
+    fixed_schema::enqueue(packet, { 42u, address1 });
+    packet.enqueue();
+    BOOST_REQUIRE(!fixed_schema::is_valid(packet));
+}
+
+// dequeue
+
+BOOST_AUTO_TEST_CASE(message_schema__dequeue__valid__expected_values_empty_message)
+{
+    message packet;
+    fixed_schema::enqueue(packet, { 42u, address1 });
+
+    fixed_schema::values values{};
+    BOOST_REQUIRE(fixed_schema::dequeue(values, packet));
+    BOOST_REQUIRE_EQUAL(std::get<0>(values), 42u);
+    BOOST_REQUIRE(std::get<1>(values) == address1);
+    BOOST_REQUIRE(packet.empty());
+}
+
+BOOST_AUTO_TEST_CASE(message_schema__dequeue__invalid__false_empty_message)
+{
+    message packet;
+    packet.enqueue(address1);
+
+    fixed_schema::values values{};
+    BOOST_REQUIRE(!fixed_schema::dequeue(values, packet));
+    BOOST_REQUIRE(packet.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
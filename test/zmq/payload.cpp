@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol::zmq;
+
+BOOST_AUTO_TEST_SUITE(payload_tests)
+
+// constuctor1
+
+BOOST_AUTO_TEST_CASE(payload__constuctor1__always__empty)
+{
+    const payload instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.data().empty());
+}
+
+// constuctor2
+
+BOOST_AUTO_TEST_CASE(payload__constuctor2__non_empty__expected_data)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    const payload instance{ data_slice{ expected } };
+    BOOST_REQUIRE(!instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    BOOST_REQUIRE(to_chunk(instance.data()) == expected);
+    BOOST_REQUIRE(instance.data().data() != expected.data());
+}
+
+// constuctor3
+
+BOOST_AUTO_TEST_CASE(payload__constuctor3__moved__adopted)
+{
+    data_chunk value(1024, 0x42);
+    const auto buffer = value.data();
+    const payload instance{ std::move(value) };
+    BOOST_REQUIRE_EQUAL(instance.size(), 1024u);
+    BOOST_REQUIRE(instance.data().data() == buffer);
+}
+
+// constuctor4
+
+BOOST_AUTO_TEST_CASE(payload__constuctor4__null__empty)
+{
+    const payload instance{ chunk_ptr{} };
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(payload__constuctor4__shared__not_copied)
+{
+    const auto shared = std::make_shared<data_chunk>(1024, 0x42);
+    const payload instance{ shared };
+    BOOST_REQUIRE(instance.data().data() == shared->data());
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+}
+
+// copy
+
+BOOST_AUTO_TEST_CASE(payload__copy__shared__not_copied)
+{
+    const auto shared = std::make_shared<data_chunk>(1024, 0x42);
+    const payload instance{ shared };
+    const payload copy{ instance };
+    BOOST_REQUIRE(copy.data().data() == shared->data());
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 3);
+}
+
+// to_frame
+
+BOOST_AUTO_TEST_CASE(payload__to_frame__empty__valid_empty_frame)
+{
+    const payload instance;
+    const auto part = instance.to_frame();
+    BOOST_REQUIRE(part);
+    BOOST_REQUIRE_EQUAL(part.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(payload__to_frame__large__references_buffer)
+{
+    const auto shared = std::make_shared<data_chunk>(1024, 0x42);
+    const payload instance{ shared };
+    {
+        const auto first = instance.to_frame();
+        const auto second = instance.to_frame();
+        BOOST_REQUIRE(first);
+        BOOST_REQUIRE(second);
+        BOOST_REQUIRE(first.data().data() == shared->data());
+        BOOST_REQUIRE(second.data().data() == shared->data());
+        BOOST_REQUIRE_EQUAL(shared.use_count(), 4);
+    }
+
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(payload__to_frame__small__copied)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    const auto shared = std::make_shared<data_chunk>(expected);
+    const payload instance{ shared };
+    const auto part = instance.to_frame();
+    BOOST_REQUIRE(part.payload() == expected);
+    BOOST_REQUIRE_EQUAL(shared.use_count(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -19,10 +19,324 @@
 #include "../test.hpp"
 #include "../utility.hpp"
 
+#if defined(__linux__)
+    #include <sys/timerfd.h>
+#endif
+
 using namespace bc::system;
 using namespace bc::protocol;
 using role = zmq::socket::role;
 
 BOOST_AUTO_TEST_SUITE(poller_tests)
 
+#define TEST_POLLER_ENDPOINT TEST_INPROC_ENDPOINT "-poller"
+
+BOOST_AUTO_TEST_CASE(poller__add__socket__true)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(socket));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(poller__add__duplicate_socket__false)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(socket));
+    BOOST_REQUIRE(!instance.add(socket));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(poller__remove__not_added__false)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(!instance.remove(socket));
+}
+
+BOOST_AUTO_TEST_CASE(poller__remove__added__true)
+{
+    zmq::context context;
+    zmq::socket first(context, role::pair);
+    zmq::socket second(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(first));
+    BOOST_REQUIRE(instance.add(second));
+    BOOST_REQUIRE(instance.remove(first));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(!instance.remove(first));
+    BOOST_REQUIRE(instance.add(first));
+}
+
+BOOST_AUTO_TEST_CASE(poller__clear__added__empty)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(socket));
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.add(socket));
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait__no_message__expired)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    REQUIRE_SUCCESS(socket.bind({ TEST_POLLER_ENDPOINT }));
+
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(socket));
+    BOOST_REQUIRE(instance.wait(1).empty());
+    BOOST_REQUIRE(instance.expired());
+    BOOST_REQUIRE(!instance.terminated());
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait__message__contains_receiver_only)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_POLLER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_POLLER_ENDPOINT }));
+
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(receiver));
+    BOOST_REQUIRE(instance.add(sender));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(sender.send(out));
+
+    const auto ready = instance.wait();
+    BOOST_REQUIRE(ready.contains(receiver.id()));
+    BOOST_REQUIRE(!ready.contains(sender.id()));
+    BOOST_REQUIRE(!instance.expired());
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait__removed__expired)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_POLLER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_POLLER_ENDPOINT }));
+
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(receiver));
+    BOOST_REQUIRE(instance.remove(receiver));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(sender.send(out));
+    BOOST_REQUIRE(instance.wait(1).empty());
+    BOOST_REQUIRE(instance.expired());
+}
+
+BOOST_AUTO_TEST_CASE(poller__add__indexes__sequential_and_reused)
+{
+    zmq::context context;
+    zmq::socket first(context, role::pair);
+    zmq::socket second(context, role::pair);
+    zmq::socket third(context, role::pair);
+    zmq::poller instance;
+
+    size_t index{ 42 };
+    BOOST_REQUIRE(instance.add(first, index));
+    BOOST_REQUIRE_EQUAL(index, 0u);
+    BOOST_REQUIRE(instance.add(second, index));
+    BOOST_REQUIRE_EQUAL(index, 1u);
+    BOOST_REQUIRE(!instance.add(second, index));
+    BOOST_REQUIRE(instance.remove(first));
+    BOOST_REQUIRE(instance.add(third, index));
+    BOOST_REQUIRE_EQUAL(index, 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__no_message__expired)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    REQUIRE_SUCCESS(socket.bind({ TEST_POLLER_ENDPOINT }));
+
+    size_t index{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(socket, index));
+    BOOST_REQUIRE(!instance.wait(ready, 1));
+    BOOST_REQUIRE(ready.empty());
+    BOOST_REQUIRE(!ready.ready(index));
+    BOOST_REQUIRE(instance.expired());
+}
+
+BOOST_AUTO_TEST_CASE(poller__modify__not_added__false)
+{
+    zmq::context context;
+    zmq::socket socket(context, role::pair);
+    zmq::poller instance;
+    BOOST_REQUIRE(!instance.modify(socket, zmq::poller::writable));
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__connected_writable__writable_index)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_POLLER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_POLLER_ENDPOINT }));
+
+    size_t index{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(sender, index, zmq::poller::writable));
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(ready.writable(index));
+    BOOST_REQUIRE(!ready.readable(index));
+
+    // Without write interest the sender (with nothing to receive) is idle.
+    BOOST_REQUIRE(instance.modify(sender, zmq::poller::readable));
+    BOOST_REQUIRE(!instance.wait(ready, 1));
+    BOOST_REQUIRE(instance.expired());
+}
+
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(poller__wait__readable_descriptor__contains_descriptor)
+{
+    int pipe[2]{};
+    BOOST_REQUIRE(is_zero(::pipe(pipe)));
+
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(pipe[0]));
+    BOOST_REQUIRE(!instance.add(pipe[0]));
+    BOOST_REQUIRE(instance.wait(1).empty());
+
+    const uint8_t byte{ 42 };
+    BOOST_REQUIRE_EQUAL(::write(pipe[1], &byte, sizeof(byte)), 1);
+    BOOST_REQUIRE(instance.wait().contains(pipe[0]));
+
+    BOOST_REQUIRE(instance.remove(pipe[0]));
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__readable_descriptor__readable_index)
+{
+    int pipe[2]{};
+    BOOST_REQUIRE(is_zero(::pipe(pipe)));
+
+    size_t index{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(pipe[0], index));
+
+    const uint8_t byte{ 42 };
+    BOOST_REQUIRE_EQUAL(::write(pipe[1], &byte, sizeof(byte)), 1);
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE_EQUAL(ready.size(), 1u);
+    BOOST_REQUIRE(ready.readable(index));
+    BOOST_REQUIRE(!ready.failed(index));
+
+    // The result is reset by each wait.
+    BOOST_REQUIRE(instance.remove(pipe[0]));
+    BOOST_REQUIRE(!instance.wait(ready, 1));
+    BOOST_REQUIRE(!ready.readable(index));
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__writable_descriptor__writable_index)
+{
+    int pipe[2]{};
+    BOOST_REQUIRE(is_zero(::pipe(pipe)));
+
+    size_t reader{};
+    size_t writer{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(pipe[0], reader));
+    BOOST_REQUIRE(instance.add(pipe[1], writer, zmq::poller::writable));
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(!ready.ready(reader));
+    BOOST_REQUIRE(ready.writable(writer));
+
+    BOOST_REQUIRE(instance.modify(pipe[1], 0));
+    BOOST_REQUIRE(!instance.wait(ready, 1));
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+}
+
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__socket_and_descriptor__modified_and_removed)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_POLLER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_POLLER_ENDPOINT }));
+
+    int pipe[2]{};
+    BOOST_REQUIRE(is_zero(::pipe(pipe)));
+
+    size_t socket_index{};
+    size_t descriptor_index{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(receiver, socket_index));
+    BOOST_REQUIRE(instance.add(pipe[0], descriptor_index));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    zmq::message message;
+    message.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(sender.send(message));
+    const uint8_t byte{ 42 };
+    BOOST_REQUIRE_EQUAL(::write(pipe[1], &byte, sizeof(byte)), 1);
+
+    // Both are readable, and remain so until read.
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(ready.readable(socket_index));
+    BOOST_REQUIRE(ready.readable(descriptor_index));
+
+    // Without interest the socket is not reported.
+    BOOST_REQUIRE(instance.modify(receiver, 0));
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(!ready.ready(socket_index));
+    BOOST_REQUIRE(ready.readable(descriptor_index));
+
+    // A removed descriptor is not reported.
+    BOOST_REQUIRE(instance.remove(pipe[0]));
+    BOOST_REQUIRE(instance.modify(receiver, zmq::poller::readable));
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(ready.readable(socket_index));
+    BOOST_REQUIRE(!ready.ready(descriptor_index));
+
+    BOOST_REQUIRE(instance.remove(receiver));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+}
+#endif
+
+#if defined(__linux__)
+BOOST_AUTO_TEST_CASE(poller__wait_readiness__timer_descriptor__readable_index)
+{
+    const auto timer = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    BOOST_REQUIRE(!is_negative(timer));
+
+    itimerspec period{};
+    period.it_value.tv_nsec = 1000000;
+    BOOST_REQUIRE(is_zero(::timerfd_settime(timer, 0, &period, nullptr)));
+
+    size_t index{};
+    zmq::readiness ready;
+    zmq::poller instance;
+    BOOST_REQUIRE(instance.add(timer, index));
+    BOOST_REQUIRE(instance.wait(ready, zmq::poller::forever));
+    BOOST_REQUIRE(ready.readable(index));
+    ::close(timer);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
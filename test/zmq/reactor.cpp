@@ -0,0 +1,329 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+#if !defined(HAVE_MSC)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(reactor_tests)
+
+#define TEST_REACTOR_ENDPOINT TEST_INPROC_ENDPOINT "-reactor"
+
+using namespace std::chrono_literals;
+
+class test_reactor
+  : public zmq::reactor
+{
+public:
+    typedef std::function<bool(test_reactor&)> opener;
+
+    test_reactor(opener&& open, size_t batch=default_batch) NOEXCEPT
+      : reactor(batch), open_(std::move(open))
+    {
+    }
+
+    ~test_reactor() NOEXCEPT
+    {
+        stop();
+    }
+
+    using reactor::attach;
+    using reactor::detach;
+    using reactor::after;
+    using reactor::every;
+    using reactor::cancel;
+
+protected:
+    bool open() NOEXCEPT override
+    {
+        return open_(*this);
+    }
+
+private:
+    opener open_;
+};
+
+class echo_reactor
+  : public zmq::reactor
+{
+public:
+    echo_reactor(zmq::context& context) NOEXCEPT
+      : replier_(context, role::replier)
+    {
+    }
+
+    ~echo_reactor() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    bool open() NOEXCEPT override
+    {
+        if (replier_.bind({ TEST_REACTOR_ENDPOINT }))
+            return false;
+
+        // Reply to one request per call, more may be pending.
+        return attach(replier_, [this](short) NOEXCEPT
+        {
+            if (request_.receive(replier_, false))
+                return false;
+
+            replier_.send(request_);
+            return true;
+        });
+    }
+
+    bool close() NOEXCEPT override
+    {
+        return replier_.stop();
+    }
+
+private:
+    zmq::socket replier_;
+    zmq::message request_;
+};
+
+BOOST_AUTO_TEST_CASE(reactor__start__open_false__false)
+{
+    test_reactor instance{ [](test_reactor&) NOEXCEPT { return false; } };
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_CASE(reactor__start_stop__open_true__true)
+{
+    test_reactor instance{ [](test_reactor&) NOEXCEPT { return true; } };
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(reactor__after__delay__fired_once)
+{
+    size_t fired{};
+    std::promise<bool> promise{};
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        self.after(1ms, [&]() NOEXCEPT
+        {
+            ++fired;
+            promise.set_value(true);
+        });
+
+        return true;
+    } };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    std::this_thread::sleep_for(10ms);
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(fired, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(reactor__after__ordered_deadlines__fired_in_order)
+{
+    std::string order{};
+    std::promise<bool> promise{};
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        self.after(20ms, [&]() NOEXCEPT
+        {
+            order += "c";
+            promise.set_value(true);
+        });
+
+        self.after(1ms, [&]() NOEXCEPT { order += "a"; });
+        self.after(10ms, [&]() NOEXCEPT { order += "b"; });
+        return true;
+    } };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(order, "abc");
+}
+
+BOOST_AUTO_TEST_CASE(reactor__every__cancelled_by_handler__fired_until_cancelled)
+{
+    size_t fired{};
+    size_t timer{};
+    std::promise<bool> promise{};
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        timer = self.every(1ms, [&]() NOEXCEPT
+        {
+            if (++fired == 3u)
+                promise.set_value(self.cancel(timer));
+        });
+
+        return true;
+    } };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    std::this_thread::sleep_for(10ms);
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(fired, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(reactor__cancel__scheduled__not_fired)
+{
+    auto fired = false;
+    std::promise<bool> promise{};
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        const auto timer = self.after(1ms, [&]() NOEXCEPT { fired = true; });
+        self.after(10ms, [&]() NOEXCEPT { promise.set_value(true); });
+        return self.cancel(timer) && !self.cancel(timer);
+    } };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE(!fired);
+}
+
+BOOST_AUTO_TEST_CASE(reactor__attach__requester__replied)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    echo_reactor instance{ context };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket requester(context, role::requester);
+    REQUIRE_SUCCESS(requester.connect({ TEST_REACTOR_ENDPOINT }));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(requester.send(out));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(requester.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE(instance.stop());
+}
+
+#if !defined(HAVE_MSC)
+
+// A non-blocking pipe preloaded with the specified number of bytes.
+class test_pipe
+{
+public:
+    test_pipe(size_t bytes) NOEXCEPT
+    {
+        BOOST_REQUIRE(is_zero(::pipe(ends_)));
+        BOOST_REQUIRE(!is_negative(::fcntl(ends_[0], F_SETFL, O_NONBLOCK)));
+        const std::string data(bytes, 'x');
+        BOOST_REQUIRE_EQUAL(::write(ends_[1], data.data(), bytes),
+            static_cast<ssize_t>(bytes));
+    }
+
+    ~test_pipe() NOEXCEPT
+    {
+        ::close(ends_[0]);
+        ::close(ends_[1]);
+    }
+
+    int reader() const NOEXCEPT
+    {
+        return ends_[0];
+    }
+
+    // Read one byte, false if none available.
+    bool read() const NOEXCEPT
+    {
+        uint8_t byte{};
+        return ::read(ends_[0], &byte, sizeof(byte)) == 1;
+    }
+
+private:
+    int ends_[2]{};
+};
+
+BOOST_AUTO_TEST_CASE(reactor__attach__busy_descriptors__dispatched_fairly)
+{
+    const test_pipe first{ 4 };
+    const test_pipe second{ 4 };
+    std::string order{};
+    std::promise<bool> promise{};
+
+    const auto reader = [&](const test_pipe& pipe, char name) NOEXCEPT
+    {
+        return [&, source = &pipe, name](short) NOEXCEPT
+        {
+            if (!source->read())
+                return false;
+
+            order += name;
+            if (order.size() == 8u)
+                promise.set_value(true);
+
+            return true;
+        };
+    };
+
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        return self.attach(first.reader(), reader(first, 'a')) &&
+            self.attach(second.reader(), reader(second, 'b'));
+    }, 2 };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+
+    // Neither descriptor is handled more than the batch limit in sequence.
+    BOOST_REQUIRE_EQUAL(order.size(), 8u);
+    BOOST_REQUIRE(order.find("aaa") == std::string::npos);
+    BOOST_REQUIRE(order.find("bbb") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(reactor__detach__by_own_handler__not_called_again)
+{
+    const test_pipe pipe{ 2 };
+    size_t called{};
+    std::promise<bool> promise{};
+
+    test_reactor instance{ [&](test_reactor& self) NOEXCEPT
+    {
+        self.after(10ms, [&]() NOEXCEPT { promise.set_value(true); });
+        return self.attach(pipe.reader(), [&](short) NOEXCEPT
+        {
+            ++called;
+            self.detach(pipe.reader());
+            return true;
+        });
+    } };
+
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(promise.get_future().get());
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(called, 1u);
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(readiness_tests)
+
+BOOST_AUTO_TEST_CASE(readiness__construct__empty)
+{
+    const zmq::readiness instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+    BOOST_REQUIRE(!instance.ready(0));
+}
+
+BOOST_AUTO_TEST_CASE(readiness__set__events__expected)
+{
+    zmq::readiness instance;
+    instance.reset(3);
+    instance.set(0, ZMQ_POLLIN);
+    instance.set(2, ZMQ_POLLOUT | ZMQ_POLLERR);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    BOOST_REQUIRE(instance.ready(0));
+    BOOST_REQUIRE(instance.readable(0));
+    BOOST_REQUIRE(!instance.writable(0));
+    BOOST_REQUIRE(!instance.failed(0));
+
+    BOOST_REQUIRE(!instance.ready(1));
+
+    BOOST_REQUIRE(instance.ready(2));
+    BOOST_REQUIRE(!instance.readable(2));
+    BOOST_REQUIRE(instance.writable(2));
+    BOOST_REQUIRE(instance.failed(2));
+}
+
+BOOST_AUTO_TEST_CASE(readiness__set__same_index__indexed_once)
+{
+    zmq::readiness instance;
+    instance.reset(1);
+    instance.set(0, ZMQ_POLLIN);
+    instance.set(0, ZMQ_POLLOUT);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(*instance.begin(), 0u);
+    BOOST_REQUIRE(instance.readable(0));
+    BOOST_REQUIRE(instance.writable(0));
+}
+
+BOOST_AUTO_TEST_CASE(readiness__set__out_of_range_or_no_events__ignored)
+{
+    zmq::readiness instance;
+    instance.reset(1);
+    instance.set(1, ZMQ_POLLIN);
+    instance.set(0, 0);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.ready(1));
+}
+
+BOOST_AUTO_TEST_CASE(readiness__reset__ready__empty)
+{
+    zmq::readiness instance;
+    instance.reset(2);
+    instance.set(1, ZMQ_POLLIN);
+    instance.reset(2);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.ready(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
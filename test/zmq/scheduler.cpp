@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(scheduler_tests)
+
+#define TEST_SCHEDULER_ENDPOINT TEST_INPROC_ENDPOINT "-scheduler"
+
+static zmq::task complete_task(bool& completed) NOEXCEPT
+{
+    completed = true;
+    co_return;
+}
+
+static zmq::task suspend_task() NOEXCEPT
+{
+    co_await std::suspend_always{};
+}
+
+static zmq::task receive_task(zmq::scheduler& scheduler, zmq::socket& socket,
+    std::string& text) NOEXCEPT
+{
+    zmq::message request;
+    if (co_await scheduler.receive(socket, request))
+        co_return;
+
+    text = request.dequeue_text();
+}
+
+static zmq::task request_task(zmq::scheduler& scheduler, zmq::socket& socket,
+    std::string& text) NOEXCEPT
+{
+    zmq::message packet;
+    packet.enqueue(TEST_MESSAGE);
+    if (co_await scheduler.send(socket, packet))
+        co_return;
+
+    if (co_await scheduler.receive(socket, packet))
+        co_return;
+
+    text = packet.dequeue_text();
+}
+
+static zmq::task reply_task(zmq::scheduler& scheduler,
+    zmq::socket& socket) NOEXCEPT
+{
+    zmq::message packet;
+    if (co_await scheduler.receive(socket, packet))
+        co_return;
+
+    co_await scheduler.send(socket, packet);
+}
+
+BOOST_AUTO_TEST_CASE(scheduler__spawn__completing_task__completed)
+{
+    auto completed = false;
+    zmq::scheduler instance;
+    instance.spawn(complete_task(completed));
+    BOOST_REQUIRE(completed);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.run());
+}
+
+BOOST_AUTO_TEST_CASE(scheduler__run__foreign_suspension__false)
+{
+    zmq::scheduler instance;
+    instance.spawn(suspend_task());
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(!instance.run());
+}
+
+BOOST_AUTO_TEST_CASE(scheduler__receive__message_sent__resumed)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_SCHEDULER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_SCHEDULER_ENDPOINT }));
+
+    std::string text{};
+    zmq::scheduler instance;
+    instance.spawn(receive_task(instance, receiver, text));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.run_one(1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(sender.send(out));
+    BOOST_REQUIRE(instance.run());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(text, TEST_MESSAGE);
+}
+
+BOOST_AUTO_TEST_CASE(scheduler__receive__same_socket__resumed_in_order)
+{
+    zmq::context context;
+    zmq::socket receiver(context, role::pair);
+    REQUIRE_SUCCESS(receiver.bind({ TEST_SCHEDULER_ENDPOINT }));
+    zmq::socket sender(context, role::pair);
+    REQUIRE_SUCCESS(sender.connect({ TEST_SCHEDULER_ENDPOINT }));
+
+    std::string first{};
+    std::string second{};
+    std::string third{};
+    zmq::scheduler instance;
+    instance.spawn(receive_task(instance, receiver, first));
+    instance.spawn(receive_task(instance, receiver, second));
+    instance.spawn(receive_task(instance, receiver, third));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+
+    zmq::message out;
+    out.enqueue("1");
+    REQUIRE_SUCCESS(sender.send(out));
+    out.enqueue("2");
+    REQUIRE_SUCCESS(sender.send(out));
+    out.enqueue("3");
+    REQUIRE_SUCCESS(sender.send(out));
+
+    BOOST_REQUIRE(instance.run());
+    BOOST_REQUIRE_EQUAL(first, "1");
+    BOOST_REQUIRE_EQUAL(second, "2");
+    BOOST_REQUIRE_EQUAL(third, "3");
+}
+
+BOOST_AUTO_TEST_CASE(scheduler__run__request_reply__interleaved)
+{
+    zmq::context context;
+    zmq::socket replier(context, role::replier);
+    REQUIRE_SUCCESS(replier.bind({ TEST_SCHEDULER_ENDPOINT }));
+    zmq::socket requester(context, role::requester);
+    REQUIRE_SUCCESS(requester.connect({ TEST_SCHEDULER_ENDPOINT }));
+
+    std::string text{};
+    zmq::scheduler instance;
+    instance.spawn(reply_task(instance, replier));
+    instance.spawn(request_task(instance, requester, text));
+    BOOST_REQUIRE(instance.run());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(text, TEST_MESSAGE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -185,7 +185,229 @@ BOOST_AUTO_TEST_CASE(socket__pair_pair__grasslands_disordered__received)
     BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "2");
 }
 
+BOOST_AUTO_TEST_CASE(socket__pair_pair__inproc_multipart__received_views)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::pair);
+    BOOST_REQUIRE(server);
+    REQUIRE_SUCCESS(server.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket client(context, role::pair);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_INPROC_ENDPOINT }));
+
+    const data_chunk large(4096, 0x42);
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    out.enqueue(data_chunk{ large });
+    REQUIRE_SUCCESS(client.send(out));
+    BOOST_REQUIRE(out.empty());
+
+    zmq::message in;
+    REQUIRE_SUCCESS(server.receive(in));
+    BOOST_REQUIRE_EQUAL(in.size(), 2u);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE(to_chunk(in.front()) == large);
+    BOOST_REQUIRE(in.dequeue_data() == large);
+    BOOST_REQUIRE(in.empty());
+}
+
+BOOST_AUTO_TEST_CASE(socket__pair_pair__inproc_non_blocking_receive__try_again_then_received)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::pair);
+    BOOST_REQUIRE(server);
+    REQUIRE_SUCCESS(server.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket client(context, role::pair);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_INPROC_ENDPOINT }));
+
+    zmq::message in;
+    BOOST_REQUIRE_EQUAL(server.receive(in, false), zmq::error::try_again);
+    BOOST_REQUIRE(in.empty());
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    out.enqueue(TEST_MESSAGE "2");
+    REQUIRE_SUCCESS(client.send(out, false));
+    BOOST_REQUIRE(out.empty());
+
+    zmq::poller poller;
+    poller.add(server);
+    BOOST_REQUIRE(poller.wait().contains(server.id()));
+    REQUIRE_SUCCESS(server.receive(in, false));
+    BOOST_REQUIRE_EQUAL(in.size(), 2u);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "2");
+}
+
+BOOST_AUTO_TEST_CASE(socket__push__no_peer_non_blocking_send__try_again_unchanged)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket pusher(context, role::pusher);
+    BOOST_REQUIRE(pusher);
+    REQUIRE_SUCCESS(pusher.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    out.enqueue(TEST_MESSAGE "2");
+    BOOST_REQUIRE_EQUAL(pusher.send(out, false), zmq::error::try_again);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE_EQUAL(out.dequeue_text(), TEST_MESSAGE "2");
+}
+
+BOOST_AUTO_TEST_CASE(socket__pair_pair__inproc_receive_batch__drained_up_to_maximum)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::pair);
+    BOOST_REQUIRE(server);
+    REQUIRE_SUCCESS(server.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket client(context, role::pair);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_INPROC_ENDPOINT }));
+
+    for (auto index = 0; index < 3; ++index)
+    {
+        zmq::message out;
+        out.enqueue_little_endian<uint32_t>(index);
+        REQUIRE_SUCCESS(client.send(out));
+    }
+
+    zmq::poller poller;
+    poller.add(server);
+    BOOST_REQUIRE(poller.wait().contains(server.id()));
+
+    size_t count{};
+    zmq::socket::messages batch;
+    REQUIRE_SUCCESS(server.receive_batch(batch, count, 2));
+    BOOST_REQUIRE_EQUAL(count, 2u);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+
+    uint32_t value{};
+    BOOST_REQUIRE(batch[0].dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 0u);
+    BOOST_REQUIRE(batch[1].dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 1u);
+
+    REQUIRE_SUCCESS(server.receive_batch(batch, count, 2));
+    BOOST_REQUIRE_EQUAL(count, 1u);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_REQUIRE(batch[0].dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 2u);
+
+    BOOST_REQUIRE_EQUAL(server.receive_batch(batch, count, 2), zmq::error::try_again);
+    BOOST_REQUIRE_EQUAL(count, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(socket__pair_pair__inproc_send_batch__all_sent_received)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::pair);
+    BOOST_REQUIRE(server);
+    REQUIRE_SUCCESS(server.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket client(context, role::pair);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket::messages batch(3);
+    batch[0].enqueue_little_endian<uint32_t>(0);
+    batch[1].enqueue_little_endian<uint32_t>(1);
+    batch[2].enqueue_little_endian<uint32_t>(2);
+
+    size_t count{};
+    REQUIRE_SUCCESS(client.send_batch(batch, count));
+    BOOST_REQUIRE_EQUAL(count, 3u);
+    BOOST_REQUIRE(batch[0].empty());
+    BOOST_REQUIRE(batch[1].empty());
+    BOOST_REQUIRE(batch[2].empty());
+
+    uint32_t value{};
+    zmq::message in;
+    REQUIRE_SUCCESS(server.receive(in));
+    BOOST_REQUIRE(in.dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 0u);
+    REQUIRE_SUCCESS(server.receive(in));
+    BOOST_REQUIRE(in.dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 1u);
+    REQUIRE_SUCCESS(server.receive(in));
+    BOOST_REQUIRE(in.dequeue(value));
+    BOOST_REQUIRE_EQUAL(value, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(socket__push__no_peer_non_blocking_send_batch__none_sent)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket pusher(context, role::pusher);
+    BOOST_REQUIRE(pusher);
+    REQUIRE_SUCCESS(pusher.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket::messages batch(2);
+    batch[0].enqueue(TEST_MESSAGE);
+    batch[1].enqueue(TEST_MESSAGE);
+
+    size_t count{};
+    BOOST_REQUIRE_EQUAL(pusher.send_batch(batch, count, false), zmq::error::try_again);
+    BOOST_REQUIRE_EQUAL(count, 0u);
+    BOOST_REQUIRE_EQUAL(batch[0].size(), 1u);
+    BOOST_REQUIRE_EQUAL(batch[1].size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(socket__pair_pair__inproc_inspect_and_forward__received_unmodified)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::pair);
+    BOOST_REQUIRE(server);
+    REQUIRE_SUCCESS(server.bind({ TEST_INPROC_ENDPOINT }));
+
+    zmq::socket client(context, role::pair);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_INPROC_ENDPOINT }));
+
+    const data_chunk large(4096, 0x42);
+    zmq::message out;
+    out.enqueue(TEST_TOPIC);
+    out.enqueue(data_chunk{ large });
+    REQUIRE_SUCCESS(client.send(out));
+
+    zmq::message relay;
+    REQUIRE_SUCCESS(server.receive(relay));
+
+    std::string topic{};
+    zmq::message::cursor reader{ relay };
+    BOOST_REQUIRE(reader.read(topic));
+    BOOST_REQUIRE_EQUAL(topic, TEST_TOPIC);
+
+    // The received parts are forwarded without being rebuilt.
+    REQUIRE_SUCCESS(server.send(relay));
+    BOOST_REQUIRE(relay.empty());
+
+    zmq::message in;
+    REQUIRE_SUCCESS(client.receive(in));
+    BOOST_REQUIRE_EQUAL(in.size(), 2u);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE(in.dequeue_data() == large);
+}
+
 // REQ and REP [asymetrical, synchronous, routable]
+
 BOOST_AUTO_TEST_CASE(socket__req_rep__grasslands__received)
 {
     zmq::context context;
@@ -1314,4 +1536,33 @@ BOOST_AUTO_TEST_CASE(socket__dealer_router_dealer_dealer_and_dealer_undelimited_
     ////dealer.stop();
 }
 
+BOOST_AUTO_TEST_CASE(socket__io_thread_affinity__default__zero)
+{
+    zmq::context context;
+    const zmq::socket instance(context, role::dealer);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.io_thread_affinity(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(socket__io_thread_affinity__settings__expected)
+{
+    context_settings context_configuration{};
+    context_configuration.io_threads = 2;
+    zmq::context context{ true, context_configuration };
+
+    settings configuration{};
+    configuration.io_thread_affinity = 2;
+    const zmq::socket instance(context, role::router, configuration);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.io_thread_affinity(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(socket__set_io_thread_affinity__valid__expected)
+{
+    zmq::context context;
+    zmq::socket instance(context, role::publisher);
+    BOOST_REQUIRE(instance.set_io_thread_affinity(1));
+    BOOST_REQUIRE_EQUAL(instance.io_thread_affinity(), 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
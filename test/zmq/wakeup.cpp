@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(wakeup_tests)
+
+BOOST_AUTO_TEST_CASE(wakeup__construct__valid)
+{
+    const zmq::wakeup instance;
+    BOOST_REQUIRE(instance);
+}
+
+BOOST_AUTO_TEST_CASE(wakeup__wait__not_notified__expired)
+{
+    zmq::wakeup instance;
+    zmq::poller poller;
+    BOOST_REQUIRE(poller.add(instance.descriptor()));
+    BOOST_REQUIRE(poller.wait(1).empty());
+    BOOST_REQUIRE(poller.expired());
+}
+
+BOOST_AUTO_TEST_CASE(wakeup__wait__notified__contains_descriptor)
+{
+    zmq::wakeup instance;
+    zmq::poller poller;
+    BOOST_REQUIRE(poller.add(instance.descriptor()));
+    BOOST_REQUIRE(instance.notify());
+    BOOST_REQUIRE(poller.wait(zmq::poller::forever).contains(instance.descriptor()));
+}
+
+BOOST_AUTO_TEST_CASE(wakeup__clear__multiple_notified__expired)
+{
+    zmq::wakeup instance;
+    zmq::poller poller;
+    BOOST_REQUIRE(poller.add(instance.descriptor()));
+    BOOST_REQUIRE(instance.notify());
+    BOOST_REQUIRE(instance.notify());
+    BOOST_REQUIRE(instance.notify());
+    instance.clear();
+    BOOST_REQUIRE(poller.wait(1).empty());
+    BOOST_REQUIRE(poller.expired());
+}
+
+BOOST_AUTO_TEST_CASE(wakeup__notify__other_thread__wakes_waiter)
+{
+    zmq::wakeup instance;
+    zmq::poller poller;
+    BOOST_REQUIRE(poller.add(instance.descriptor()));
+
+    std::thread notifier([&]() NOEXCEPT
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        instance.notify();
+    });
+
+    BOOST_REQUIRE(poller.wait(zmq::poller::forever).contains(instance.descriptor()));
+    notifier.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,11 +17,245 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
 
 BOOST_AUTO_TEST_SUITE(worker_tests)
 
+class worker_fixture
+  : public zmq::worker
+{
+public:
+    using worker::forward;
+
+protected:
+    void work() NOEXCEPT override
+    {
+    }
+};
+
+class relay_fixture
+  : public zmq::worker
+{
+public:
+    relay_fixture(zmq::context& context) NOEXCEPT
+      : context_(context)
+    {
+    }
+
+    ~relay_fixture() NOEXCEPT
+    {
+        stop();
+    }
+
+    std::atomic<bool> terminated{ false };
+
+protected:
+    void work() NOEXCEPT override
+    {
+        zmq::socket left(context_, role::pair);
+        zmq::socket right(context_, role::pair);
+
+        const auto bound =
+            !left.bind({ TEST_INPROC_ENDPOINT "-left" }) &&
+            !right.bind({ TEST_INPROC_ENDPOINT "-right" });
+
+        if (!started(bound))
+            return;
+
+        terminated = relay(context_, left, right);
+        finished(left.stop() && right.stop());
+    }
+
+private:
+    zmq::context& context_;
+};
+
+class uncontrolled_fixture
+  : public zmq::worker
+{
+public:
+    uncontrolled_fixture(zmq::context& context) NOEXCEPT
+      : context_(context)
+    {
+    }
+
+    ~uncontrolled_fixture() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    void work() NOEXCEPT override
+    {
+        zmq::socket left(context_, role::pair);
+        zmq::socket right(context_, role::pair);
+
+        const auto bound =
+            !left.bind({ TEST_INPROC_ENDPOINT "-uncontrolled-left" }) &&
+            !right.bind({ TEST_INPROC_ENDPOINT "-uncontrolled-right" });
+
+        if (!started(bound))
+            return;
+
+        relay(left, right);
+        finished(left.stop() && right.stop());
+    }
+
+private:
+    zmq::context& context_;
+};
+
+class pinned_fixture
+  : public zmq::worker
+{
+public:
+    using worker::worker;
+
+protected:
+    void work() NOEXCEPT override
+    {
+        if (!started(true))
+            return;
+
+        while (!stopped())
+            std::this_thread::yield();
+
+        finished(true);
+    }
+};
+
 BOOST_AUTO_TEST_CASE(worker_test)
 {
 }
 
+BOOST_AUTO_TEST_CASE(worker__start__no_affinity__true)
+{
+    pinned_fixture instance{};
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(worker__start__invalid_affinity__false)
+{
+    pinned_fixture instance{ thread_priority::normal, { max_size_t } };
+    BOOST_REQUIRE(!instance.start());
+}
+
+// Windows has no scheduling policy, so the priority is not range checked.
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(worker__start__invalid_schedule__false)
+{
+    const thread_schedule schedule{ thread_policy::round_robin, 1000 };
+    pinned_fixture instance{ thread_priority::normal, {}, schedule };
+    BOOST_REQUIRE(!instance.start());
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(worker__relay__not_started__no_control)
+{
+    zmq::context context;
+    relay_fixture instance{ context };
+    zmq::worker::relay_statistics statistics{};
+    BOOST_REQUIRE(!instance.pause());
+    BOOST_REQUIRE(!instance.resume());
+    BOOST_REQUIRE(!instance.statistics(statistics));
+}
+
+BOOST_AUTO_TEST_CASE(worker__relay__stop__terminated_with_statistics)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    relay_fixture instance{ context };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket left(context, role::pair);
+    REQUIRE_SUCCESS(left.connect({ TEST_INPROC_ENDPOINT "-left" }));
+    zmq::socket right(context, role::pair);
+    REQUIRE_SUCCESS(right.connect({ TEST_INPROC_ENDPOINT "-right" }));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(left.send(out));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(right.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+
+    BOOST_REQUIRE(instance.pause());
+    BOOST_REQUIRE(instance.resume());
+
+    zmq::worker::relay_statistics statistics{};
+    BOOST_REQUIRE(instance.statistics(statistics));
+    BOOST_REQUIRE_EQUAL(statistics.left.messages_received, 1u);
+    BOOST_REQUIRE_EQUAL(statistics.left.bytes_received, sizeof(TEST_MESSAGE) - 1u);
+    BOOST_REQUIRE_EQUAL(statistics.right.messages_sent, 1u);
+    BOOST_REQUIRE_EQUAL(statistics.right.bytes_sent, sizeof(TEST_MESSAGE) - 1u);
+
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE(instance.terminated);
+    BOOST_REQUIRE(!instance.statistics(statistics));
+}
+
+BOOST_AUTO_TEST_CASE(worker__relay__uncontrolled_context_stop__terminated)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    uncontrolled_fixture instance{ context };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::worker::relay_statistics statistics{};
+    BOOST_REQUIRE(!instance.pause());
+    BOOST_REQUIRE(!instance.statistics(statistics));
+
+    // Context stop blocks until the relay closes its sockets.
+    BOOST_REQUIRE(context.stop());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(worker__forward__multipart__received_in_order)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket source(context, role::pair);
+    REQUIRE_SUCCESS(source.bind({ TEST_INPROC_ENDPOINT "1" }));
+    zmq::socket from(context, role::pair);
+    REQUIRE_SUCCESS(from.connect({ TEST_INPROC_ENDPOINT "1" }));
+
+    zmq::socket to(context, role::pair);
+    REQUIRE_SUCCESS(to.bind({ TEST_INPROC_ENDPOINT "2" }));
+    zmq::socket sink(context, role::pair);
+    REQUIRE_SUCCESS(sink.connect({ TEST_INPROC_ENDPOINT "2" }));
+
+    const data_chunk large(4096, 0x42);
+    for (auto index = 0; index < 2; ++index)
+    {
+        zmq::message out;
+        out.enqueue(TEST_MESSAGE);
+        out.enqueue();
+        out.enqueue(data_chunk{ large });
+        REQUIRE_SUCCESS(source.send(out));
+    }
+
+    worker_fixture instance;
+    BOOST_REQUIRE(instance.forward(from, to));
+    BOOST_REQUIRE(instance.forward(from, to));
+
+    for (auto index = 0; index < 2; ++index)
+    {
+        zmq::message in;
+        REQUIRE_SUCCESS(sink.receive(in));
+        BOOST_REQUIRE_EQUAL(in.size(), 3u);
+        BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+        BOOST_REQUIRE(in.dequeue_data().empty());
+        BOOST_REQUIRE(in.dequeue_data() == large);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(worker_pool_tests)
+
+#define TEST_POOL_ENDPOINT TEST_INPROC_ENDPOINT "-pool"
+
+class echo_pool
+  : public zmq::worker_pool
+{
+public:
+    using worker_pool::worker_pool;
+
+    ~echo_pool() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    void handle(zmq::message& request, zmq::message& reply) NOEXCEPT override
+    {
+        reply.enqueue(request.dequeue_text());
+    }
+};
+
+class silent_pool
+  : public zmq::worker_pool
+{
+public:
+    using worker_pool::worker_pool;
+
+    ~silent_pool() NOEXCEPT
+    {
+        stop();
+    }
+
+protected:
+    void handle(zmq::message&, zmq::message&) NOEXCEPT override
+    {
+    }
+};
+
+BOOST_AUTO_TEST_CASE(worker_pool__threads__default__cores)
+{
+    zmq::context context;
+    const echo_pool instance{ context, { TEST_POOL_ENDPOINT } };
+    BOOST_REQUIRE_EQUAL(instance.threads(), cores());
+}
+
+BOOST_AUTO_TEST_CASE(worker_pool__threads__explicit__expected)
+{
+    zmq::context context;
+    const echo_pool instance{ context, { TEST_POOL_ENDPOINT }, 3 };
+    BOOST_REQUIRE_EQUAL(instance.threads(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(worker_pool__start__requests__replied)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    echo_pool instance{ context, { TEST_POOL_ENDPOINT }, 2 };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket first(context, role::requester);
+    REQUIRE_SUCCESS(first.connect({ TEST_POOL_ENDPOINT }));
+    zmq::socket second(context, role::requester);
+    REQUIRE_SUCCESS(second.connect({ TEST_POOL_ENDPOINT }));
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE "1");
+    REQUIRE_SUCCESS(first.send(out));
+    out.enqueue(TEST_MESSAGE "2");
+    REQUIRE_SUCCESS(second.send(out));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(second.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "2");
+    REQUIRE_SUCCESS(first.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE "1");
+
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(worker_pool__start__empty_reply__empty_part)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    silent_pool instance{ context, { TEST_POOL_ENDPOINT }, 1 };
+    BOOST_REQUIRE(instance.start());
+
+    zmq::socket requester(context, role::requester);
+    REQUIRE_SUCCESS(requester.connect({ TEST_POOL_ENDPOINT }));
+
+    // The replier must be able to reply again after an empty reply.
+    for (size_t request = 0; request < 2u; ++request)
+    {
+        zmq::message out;
+        out.enqueue(TEST_MESSAGE);
+        REQUIRE_SUCCESS(requester.send(out));
+
+        zmq::message in;
+        REQUIRE_SUCCESS(requester.receive(in));
+        BOOST_REQUIRE_EQUAL(in.size(), 1u);
+        BOOST_REQUIRE(in.dequeue_data().empty());
+        BOOST_REQUIRE(in.empty());
+    }
+
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(worker_pool__start__endpoint_in_use__false)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket existing(context, role::router);
+    REQUIRE_SUCCESS(existing.bind({ TEST_POOL_ENDPOINT }));
+
+    echo_pool instance{ context, { TEST_POOL_ENDPOINT }, 2 };
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_SUITE_END()